@@ -41,6 +41,8 @@
 #include "apl/datasource/datasourceconnection.h"
 #include "apl/datasource/datasourceprovider.h"
 #include "apl/engine/event.h"
+#include "apl/engine/inputrecorder.h"
+#include "apl/engine/inputreplayer.h"
 #include "apl/engine/rootcontext.h"
 #include "apl/extension/extensionclient.h"
 #include "apl/focus/focusdirection.h"
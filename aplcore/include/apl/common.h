@@ -64,6 +64,8 @@ class GraphicContent;
 class GraphicElement;
 class Graphic;
 class GraphicPattern;
+class InputRecorder;
+class InputReplayer;
 class LiveArray;
 class LiveMap;
 class LiveObject;
@@ -71,6 +73,7 @@ class MediaManager;
 class MediaObject;
 class MediaPlayer;
 class MediaPlayerFactory;
+class MediaPlayerPool;
 class Package;
 class RootConfig;
 class RootContext;
@@ -98,6 +101,8 @@ using GraphicContentPtr = std::shared_ptr<GraphicContent>;
 using GraphicElementPtr = std::shared_ptr<GraphicElement>;
 using GraphicPtr = std::shared_ptr<Graphic>;
 using GraphicPatternPtr = std::shared_ptr<GraphicPattern>;
+using InputRecorderPtr = std::shared_ptr<InputRecorder>;
+using InputReplayerPtr = std::shared_ptr<InputReplayer>;
 using LiveArrayPtr = std::shared_ptr<LiveArray>;
 using LiveMapPtr = std::shared_ptr<LiveMap>;
 using LiveObjectPtr = std::shared_ptr<LiveObject>;
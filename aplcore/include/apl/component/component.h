@@ -488,6 +488,20 @@ public:
 
     virtual bool isCharacterValid(const wchar_t wc) const;
 
+    /**
+     * Check a whole string in one call, rather than one isCharacterValid() call per character.
+     * @param text A UTF-8 encoded string.
+     * @return True if every character in the string is valid.
+     */
+    virtual bool isTextValid(const std::string& text) const;
+
+    /**
+     * Remove every character isCharacterValid() would reject from a string.
+     * @param text A UTF-8 encoded string.
+     * @return The valid characters of the string.
+     */
+    virtual std::string filterText(const std::string& text) const;
+
     /**
      * This function will be called for dynamic component inflation
      */
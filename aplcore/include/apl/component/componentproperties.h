@@ -600,6 +600,8 @@ enum PropertyKey {
     kPropertyPageId,
     /// Pager virtual property for the index of the current page
     kPropertyPageIndex,
+    /// PagerComponent descriptor of the default page transition in progress (output only)
+    kPropertyPageTransition,
     /// VideoComponent current playing state
     kPropertyPlayingState,
     /// ContainerComponent child absolute or relative position (see #Position)
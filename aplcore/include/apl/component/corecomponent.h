@@ -549,6 +549,13 @@ public:
      */
     virtual void postProcessLayoutChanges();
 
+    /**
+     * Resolve layout dependent state that was invalidated outside of a layout pass.  Scheduled with
+     * LayoutManager::requestLayoutChanges and called at most once per layout pass.
+     * @param useDirtyFlag true to notify runtime about changes with dirty properties
+     */
+    virtual void processPendingLayoutChanges(bool useDirtyFlag) {}
+
     /**
      * Update the event object map with additional properties.  These fill out "event.XXX" values other
      * than the "event.source" and "event.target" properties. Subclasses should call the parent class
@@ -567,6 +574,19 @@ public:
      */
     virtual void updateStyle();
 
+    /**
+     * Update the style of the component and the children inheriting its state after a state change.  Components
+     * whose style does not observe any of the changed states keep their current styled properties.
+     * @param changedStates Bit mask of the StateProperty values that changed.
+     */
+    void updateStyleForStates(unsigned int changedStates);
+
+    /**
+     * @param changedStates Bit mask of StateProperty values.
+     * @return True if the styled properties of this component may depend on one of those states.
+     */
+    virtual bool isStyleSensitiveTo(unsigned int changedStates) const;
+
     /**
      * Attach Component's visual context tags to provided Json object.
      * NOTE: Required to be called explicitly from overriding methods.
@@ -998,6 +1018,12 @@ protected:
         return { Object::NULL_OBJECT(), false };
     }
 
+    /**
+     * Called when this component has been attached to a new parent.
+     * @param parent The new parent.
+     */
+    virtual void attachedToParent(const CoreComponentPtr& parent);
+
 private:
     friend streamer& operator<<(streamer&, const Component&);
 
@@ -1008,8 +1034,6 @@ private:
 
     bool appendChild(const ComponentPtr& child, bool useDirtyFlag);
 
-    void attachedToParent(const CoreComponentPtr& parent);
-
     void removeChild(const CoreComponentPtr& child, bool useDirtyFlag);
 
     void removeChildAt(size_t index, bool useDirtyFlag);
@@ -42,6 +42,10 @@ public:
 
     bool isCharacterValid(const wchar_t wc) const override;
 
+    bool isTextValid(const std::string& text) const override;
+
+    std::string filterText(const std::string& text) const override;
+
     void parseValidCharactersProperty();
 
 protected:
@@ -55,6 +55,8 @@ public:
     bool isVertical() const override { return getCalculated(kPropertyScrollDirection) == kScrollDirectionVertical; }
     Point getSnapOffset() const override;
     bool shouldForceSnap() const override;
+    void setScrollProjection(const Point& destination) override;
+    void clearScrollProjection() override;
 
     /**
      * @return first visible child index
@@ -184,9 +186,12 @@ private:
     void attachYogaNodeIfRequired(const CoreComponentPtr& coreChild, int index) override;
     bool attachChild(const CoreComponentPtr& child, size_t index);
     void runLayoutHeuristics(size_t anchorIdx, float childCache, float pageSize, bool useDirtyFlag, bool first);
+    void attachChildrenToCover(size_t anchorIdx, float distance, bool useDirtyFlag);
+    int coverageStartIndex(int anchorIdx) const;
     void fixScrollPosition(const Rect& oldAnchorRect, const Rect& anchorRect);
     Point getPaddedScrollPosition(LayoutDirection layoutDirection) const;
     void processLayoutChangesInternal(bool useDirtyFlag, bool first, bool delayed);
+    bool isPassingOver() const;
 
 private:
     Range mIndexesSeen;
@@ -201,6 +206,11 @@ private:
     int mLastChildInView = -1;
 
     ActionPtr mDelayLayoutAction;
+
+    // Projected resting position of an ongoing fling, used to defer layout of passed over children.
+    bool mHasScrollProjection = false;
+    bool mScrollLayoutDeferred = false;
+    Point mScrollProjection;
 };
 } // namespace apl
 
@@ -18,6 +18,7 @@
 
 #include "actionablecomponent.h"
 #include "apl/engine/event.h"
+#include "apl/touch/utils/pagemovehandler.h"
 
 namespace apl {
 
@@ -88,6 +89,18 @@ public:
      */
     void endPageMove(bool fulfilled, const ActionRef& ref = ActionRef(nullptr), bool fast = true);
 
+    /**
+     * Publish a phase of a host composited page move, see RootConfig::kExperimentalFeatureHostPageTransitions.
+     * Does nothing for other page moves.
+     * @param phase transition phase.
+     * @param startAmount move amount the phase starts at.
+     * @param endAmount move amount the phase ends at.
+     * @param duration duration of the phase in milliseconds, 0 when driven by the pointer.
+     * @return true if the phase was published, false if the page move is not host composited.
+     */
+    bool publishPageTransition(PageTransitionPhase phase, float startAmount, float endAmount,
+                               apl_duration_t duration);
+
 protected:
     const ComponentPropDefSet& propDefSet() const override;
     const EventPropertyMap & eventPropertyMap() const override;
@@ -110,6 +123,8 @@ private:
     void setPageImmediate(int pageIndex);
     void handleSetPage(int index, PageDirection direction, const ActionRef& ref, bool skipDefaultAnimation);
     PageDirection focusDirectionToPage(FocusDirection direction);
+    void resetPageMoveHandler();
+    void clearPageTransition();
 
     void reportLoadedInternal(size_t index);
 
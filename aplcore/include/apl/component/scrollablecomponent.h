@@ -36,6 +36,19 @@ public:
      */
     virtual bool shouldForceSnap() const { return false; }
 
+    /**
+     * Notify the component that the scroll position is being driven by a fling that is expected to come to rest
+     * at the provided position. Called on every scroller update. Scroll commands do not project their
+     * destination, so the children they pass over are still loaded.
+     * @param destination projected resting scroll position.
+     */
+    virtual void setScrollProjection(const Point& destination) {}
+
+    /**
+     * Notify the component that the AutoScroller driving the scroll position has finished or was abandoned.
+     */
+    virtual void clearScrollProjection() {}
+
     void update(UpdateType type, float value) override;
     bool canConsumeFocusDirectionEvent(FocusDirection direction, bool fromInside) override;
     CoreComponentPtr takeFocusFromChild(FocusDirection direction, const Rect& origin) override;
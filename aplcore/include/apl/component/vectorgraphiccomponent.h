@@ -31,6 +31,7 @@ public:
     ComponentType getType() const override { return kComponentTypeVectorGraphic; };
     void initialize() override;
     void updateStyle() override;
+    bool isStyleSensitiveTo(unsigned int changedStates) const override;
     bool updateGraphic(const GraphicContentPtr& json) override;
     void clearDirty() override;
     std::shared_ptr<ObjectMap> createTouchEventProperties(const Point &point) const override;
@@ -40,10 +41,17 @@ public:
     bool isActionable() const override;
     bool isTouchable() const override;
 
+    /**
+     * @internal
+     * @return Number of media bounds computations performed by this component. For testing only.
+     */
+    unsigned int getMediaBoundsUpdateCount() const { return mMediaBoundsUpdateCount; }
+
 protected:
     const EventPropertyMap& eventPropertyMap() const override;
     const ComponentPropDefSet& propDefSet() const override;
     void processLayoutChanges(bool useDirtyFlag, bool first) override;
+    void processPendingLayoutChanges(bool useDirtyFlag) override;
 
 protected:
     std::string getVisualContextType() const override;
@@ -59,8 +67,14 @@ protected:
     // Component trait overrides
     CoreComponentPtr getComponent() override { return shared_from_corecomponent(); }
 
+private:
+    void requestMediaBoundsUpdate();
+    void updateMediaBounds(bool useDirtyFlag);
+
 private:
     bool mOnLoadOnFailReported = false;
+    bool mMediaBoundsPending = false;
+    unsigned int mMediaBoundsUpdateCount = 0;
 };
 
 
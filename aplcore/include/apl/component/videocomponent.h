@@ -29,6 +29,7 @@ public:
     virtual ~VideoComponent() noexcept;
 
     ComponentType getType() const override { return kComponentTypeVideo; };
+    void release() override;
     bool remove() override;
 
     void updateMediaState(const MediaState& state, bool fromEvent) override;
@@ -45,12 +46,17 @@ protected:
     void assignProperties(const ComponentPropDefSet &propDefSet) override;
 
 private:
+    void attachedToParent(const CoreComponentPtr& parent) override;
+
+    void acquireMediaPlayer();
+    void releaseMediaPlayer();
     void saveMediaState(const MediaState& state);
     std::shared_ptr<ObjectMap> createDefaultEventProperties();
     std::shared_ptr<ObjectMap> createErrorEventProperties(int errorCode);
     std::shared_ptr<ObjectMap> createReadyEventProperties();
 
     MediaPlayerPtr mMediaPlayer;
+    bool mMediaPlayerReleased = false;  // Player was handed back to the pool when the component was detached
     const std::string mMediaSequencer;  // Internal sequencer used for onEnd/onPause/onPlay
 };
 
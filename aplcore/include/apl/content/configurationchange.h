@@ -176,6 +176,14 @@ public:
      */
     ObjectMap asEventProperties(const RootConfig& rootConfig, const Metrics& metrics) const;
 
+    /**
+     * Serialize the properties that have been set in this configuration change.  Properties that
+     * have not been set are omitted.
+     * @param allocator RapidJSON memory allocator
+     * @return The serialized configuration change
+     */
+    rapidjson::Value serialize(rapidjson::Document::AllocatorType& allocator) const;
+
     /**
      * @return True if the configuration change is empty
      */
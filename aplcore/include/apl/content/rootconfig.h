@@ -91,6 +91,9 @@ public:
         kExperimentalFeatureFocusEditTextOnTap,
         /// Send even when core assumes keyboard input is required
         kExperimentalFeatureRequestKeyboard,
+        /// Publish the default Pager page transition as a single descriptor for the viewhost to animate
+        /// instead of updating page transforms on every frame
+        kExperimentalFeatureHostPageTransitions,
     };
 
     /**
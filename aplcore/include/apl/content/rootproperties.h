@@ -136,6 +136,12 @@ enum RootProperty {
     kTextMeasurementCacheLimit,
     /// Initial display state of the document, used by core prior to any display state updates
     kInitialDisplayState,
+    /// Number of idle media players kept for reuse by new Video components.  0 disables pooling.
+    kMediaPlayerPoolSize,
+    /// Maximum number of media requests outstanding with the view host.  0 sends every request immediately.
+    kMaxMediaRequestsInFlight,
+    /// Distance in dp from the viewport beyond which media requests are held back or cancelled.  Negative disables.
+    kMediaRequestCancelDistance,
 };
 
 extern Bimap<int, std::string> sRootPropertyBimap;
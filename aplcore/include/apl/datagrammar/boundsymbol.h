@@ -42,6 +42,11 @@ public:
 
     SymbolReference getSymbol() const { return SymbolReference(mName + "/", mContext.lock()); }
 
+    /**
+     * @return The name of the symbol
+     */
+    const std::string& getName() const { return mName; }
+
     std::string toDebugString() const override;
 
     bool operator==(const BoundSymbol& rhs) const;
@@ -201,6 +201,17 @@ public:
      */
     void symbols(SymbolReferenceMap& symbols);
 
+    /**
+     * Infer how coarsely this byte code observes a clock symbol such as "localTime".  A clock that is only
+     * passed through a quantizing function (for example, Time.minutes(localTime), Time.format('HH:mm', localTime)
+     * or Math.floor(elapsedTime/1000)) can only change the result of the expression when it crosses a boundary.
+     * This method should be called after the byte code has been optimized.
+     * @param symbol The name of the clock symbol.
+     * @return The granularity in milliseconds, 1 if every change of the symbol may be observed,
+     *         or 0 if the symbol is not referenced.
+     */
+    apl_duration_t clockGranularity(const std::string& symbol) const;
+
     /**
      * Decompile the byte code and write the disassembled code to the LOG.
      */
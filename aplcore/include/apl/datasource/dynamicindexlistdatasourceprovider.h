@@ -117,6 +117,45 @@ public:
      */
     bool processUpdate(DynamicIndexListUpdateType type, int index, const Object& data, int count);
 
+    /**
+     * Check if a single item insert at the provided index would be applied. Does not change the data.
+     * @param index index as per source specification.
+     * @return true if insert is possible, false otherwise.
+     */
+    bool canInsert(int index) const;
+
+    /**
+     * Check if a number of single item removals at the provided index would all be applied. Does not change the data.
+     * @param index index as per source specification.
+     * @param count number of removals.
+     * @return true if all removals are possible, false otherwise.
+     */
+    bool canRemove(int index, size_t count) const;
+
+    /**
+     * Insert items at consecutive indexes as a single change. Equivalent to a single item insert per item, should
+     * only be called after canInsert() returned true for the same index.
+     * @param index index of the first item.
+     * @param data items to insert.
+     * @return true if successful, false otherwise.
+     */
+    bool processInsertRun(int index, const ObjectArray& data);
+
+    /**
+     * Remove items at the same index as a single change. Equivalent to the same number of single item removals,
+     * should only be called after canRemove() returned true for the same arguments.
+     * @param index index to remove at.
+     * @param count number of items to remove.
+     * @return true if successful, false otherwise.
+     */
+    bool processRemoveRun(int index, size_t count);
+
+    /**
+     * Account for a single item insert immediately followed by a removal at the same index without touching the
+     * data. Should only be called after canInsert() returned true for that index.
+     */
+    void skipInsertRemove();
+
     /**
      * Process lazy loading response.
      * Performs adjustments required to match source parameters to internal implementation.
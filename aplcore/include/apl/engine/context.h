@@ -19,8 +19,10 @@
 #include <memory>
 #include <string>
 #include <exception>
+#include <functional>
 #include <memory>
 #include <map>
+#include <vector>
 #include <yoga/Yoga.h>
 
 #include "apl/common.h"
@@ -306,6 +308,56 @@ public:
      */
     bool systemUpdateAndRecalculate(const std::string& key, const Object& value, bool useDirtyFlag);
 
+    /**
+     * Add a dependant object that is downstream of this context.  Dependants of a clock value are also
+     * scheduled at the next clock boundary they observe.  Dependants of a live data object are also
+     * indexed by the member they refer to, see recalculateDownstreamMembers.
+     * @param key The key of the local element.
+     * @param dependant The dependant object.
+     * @return True if the dependant was added, false if the pair already exists.
+     */
+    bool addDownstream(const std::string& key, const std::shared_ptr<Dependant>& dependant);
+
+    /**
+     * Remove this downstream dependant object.
+     * @param dependant The object to remove
+     */
+    void removeDownstream(const std::shared_ptr<Dependant>& dependant);
+
+    /**
+     * Some members of a live data object in the current context have changed.  Only the downstream dependants
+     * referring to the object as a whole or to one of the changed members are recalculated.  For example,
+     * changing "progress" in a live map recalculates ${player.progress} but not ${player.title}.
+     * @param key The string key name of the live data object.
+     * @param changed Called with the name of each referenced member (a map key or an array index),
+     *                returns true if that member has changed.
+     * @param useDirtyFlag If true, mark changes downstream with a dirty flag
+     */
+    void recalculateDownstreamMembers(const std::string& key,
+                                      const std::function<bool(const std::string&)>& changed,
+                                      bool useDirtyFlag);
+
+    /**
+     * Mutate a clock value (such as "elapsedTime" or "localTime") in the current context.  Unlike
+     * systemUpdateAndRecalculate, only those downstream dependants that observe a boundary crossed by
+     * the change are recalculated.  For example, ${Time.format('HH:mm', localTime)} is recalculated once a minute.
+     * Dependants are kept ordered by their next boundary, so those that are not due are not visited.
+     * This method ONLY searches in the current context.
+     * @param key The string key name.
+     * @param value The updated clock value.
+     * @param useDirtyFlag If true, mark changes downstream with a dirty flag
+     * @return True if the key already exists in this context (it may not be changed)
+     */
+    bool systemUpdateClockAndRecalculate(const std::string& key, apl_time_t value, bool useDirtyFlag);
+
+    /**
+     * Calculate how far a clock value in the current context can advance before one of its downstream
+     * dependants needs to be recalculated.
+     * @param key The string key name of the clock.
+     * @return The delay in milliseconds or the maximum duration if there are no dependants.
+     */
+    apl_duration_t clockBoundaryDelay(const std::string& key);
+
     /**
      * Store a value in the current context.  If the value already exists in the current
      * context, nothing is written.  The value is stored as a fixed property and may not be changed.
@@ -580,6 +632,7 @@ public:
     LayoutManager& layoutManager() const;
     MediaManager& mediaManager() const;
     MediaPlayerFactory& mediaPlayerFactory() const;
+    MediaPlayerPool& mediaPlayerPool() const;
 
     std::shared_ptr<Styles> styles() const;
 
@@ -607,6 +660,26 @@ protected:
     std::map<std::string, ContextObject> mMap;
 
 private:
+    struct ClockDependant {
+        apl_duration_t granularity;
+        std::weak_ptr<Dependant> dependant;
+    };
+
+    struct ClockSchedule {
+        apl_time_t time;
+        std::vector<std::weak_ptr<Dependant>> everyChange;          // Dependants observing every change
+        std::multimap<apl_time_t, ClockDependant> boundaries;       // Quantized dependants by next boundary
+    };
+
+    ClockSchedule& clockSchedule(const std::string& key, apl_time_t time);
+    static void scheduleClockDependant(ClockSchedule& schedule, const std::shared_ptr<Dependant>& dependant,
+                                       apl_duration_t granularity);
+
+    std::map<std::string, ClockSchedule> mClocks;
+
+    // Dependants of live data objects by the first member of their path, an empty member refers to the whole object
+    std::map<std::string, std::multimap<std::string, std::weak_ptr<Dependant>>> mMemberDownstream;
+
     /**
      * Initialize environment parameters for the context
      * @param metrics The display metrics.
@@ -56,6 +56,13 @@ public:
      */
     virtual void recalculate(bool useDirtyFlag) const = 0;
 
+    /**
+     * Calculate how coarsely this dependant observes a clock value such as "localTime".
+     * @param symbol The name of the clock symbol.
+     * @return The granularity in milliseconds.  A value of 1 means every change is observed.
+     */
+    apl_duration_t clockGranularity(const std::string& symbol) const;
+
 protected:
     Object mEquation;                        // The equation or expression to be evaluated
     std::weak_ptr<Context> mBindingContext;  // The context the BindingFunction will be applied in
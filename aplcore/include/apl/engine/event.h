@@ -178,6 +178,21 @@ enum EventType {
      * Does not have an ActionRef
      */
     kEventTypeOpenKeyboard,
+
+    /**
+     * The document no longer needs media that was previously requested with kEventTypeMediaRequest.
+     * Only issued when @c ExperimentalFeature::kExperimentalFeatureManageMediaRequests is enabled and
+     * RootProperty::kMediaRequestCancelDistance is not negative.  Sent when the components that needed
+     * the media were released, or have moved further than the cancel distance from the viewport.
+     *
+     * kEventPropertySource: the source URIs of the media that is no longer needed
+     * kEventPropertyMediaType: the type of media
+     *
+     * Does not have an ActionRef
+     *
+     * Note: The runtime may abort the download.  A cancelled source may be requested again later.
+     */
+    kEventTypeMediaCancel,
 };
 
 enum EventProperty {
@@ -0,0 +1,114 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef _APL_INPUT_RECORDER_H
+#define _APL_INPUT_RECORDER_H
+
+#include <string>
+#include <vector>
+
+#include "rapidjson/document.h"
+
+#include "apl/common.h"
+#include "apl/document/displaystate.h"
+#include "apl/primitives/keyboard.h"
+#include "apl/primitives/object.h"
+#include "apl/utils/bimap.h"
+
+namespace apl {
+
+class ConfigurationChange;
+struct PointerEvent;
+
+/**
+ * The type of a recorded input.  Each record in a trace has exactly one type.
+ */
+enum InputRecordType {
+    kInputRecordUpdateTime,
+    kInputRecordPointerEvent,
+    kInputRecordKeyboard,
+    kInputRecordConfigurationChange,
+    kInputRecordDisplayState,
+    kInputRecordMediaLoaded,
+    kInputRecordMediaLoadFailed,
+    kInputRecordExecuteCommands,
+    kInputRecordExtensionEvent,
+    kInputRecordCancelExecution,
+    kInputRecordReinflate,
+};
+
+extern Bimap<InputRecordType, std::string> sInputRecordTypeBimap;
+
+/**
+ * Captures the inputs a view host passes into a RootContext so that a session can be replayed
+ * with an InputReplayer.  Attach a recorder with RootContext::setInputRecorder(); from then on
+ * every call to updateTime, handlePointerEvent, handleKeyboard, configurationChange,
+ * updateDisplayState, mediaLoaded, mediaLoadFailed, executeCommands, invokeExtensionEventHandler,
+ * cancelExecution and reinflate is appended to the trace along with the document time at which
+ * it was made.
+ *
+ * The trace is serialized as one compact JSON object per line, for example:
+ *
+ *     {"time":1200,"type":"pointer","event":0,"x":10,"y":20,"id":0,"pointer":1}
+ *
+ * Recording is opt-in; a RootContext without a recorder does no extra work.
+ */
+class InputRecorder {
+public:
+    /**
+     * @return A new, empty recorder
+     */
+    static InputRecorderPtr create() { return std::make_shared<InputRecorder>(); }
+
+    void recordUpdateTime(apl_time_t elapsedTime);
+    void recordUpdateTime(apl_time_t elapsedTime, apl_time_t utcTime);
+    void recordPointerEvent(apl_time_t time, const PointerEvent& pointerEvent);
+    void recordKeyboard(apl_time_t time, KeyHandlerType type, const Keyboard& keyboard);
+    void recordConfigurationChange(apl_time_t time, const ConfigurationChange& change);
+    void recordDisplayState(apl_time_t time, DisplayState displayState);
+    void recordMediaLoaded(apl_time_t time, const std::string& source);
+    void recordMediaLoadFailed(apl_time_t time, const std::string& source, int errorCode, const std::string& error);
+    void recordExecuteCommands(apl_time_t time, const Object& commands, bool fastMode);
+    void recordExtensionEvent(apl_time_t time, const std::string& uri, const std::string& name,
+                              const ObjectMap& data, bool fastMode, const std::string& resourceId);
+    void recordCancelExecution(apl_time_t time);
+    void recordReinflate(apl_time_t time);
+
+    /**
+     * @return The number of inputs recorded so far.
+     */
+    size_t size() const { return mRecords.size(); }
+
+    /**
+     * Drop all of the inputs recorded so far.
+     */
+    void clear() { mRecords.clear(); }
+
+    /**
+     * @return The trace as newline-separated JSON objects, suitable for writing to a file and
+     *         passing to InputReplayer::create().
+     */
+    std::string serialize() const;
+
+private:
+    static rapidjson::Document start(apl_time_t time, InputRecordType type);
+    void append(const rapidjson::Document& record);
+
+    std::vector<std::string> mRecords;  // Each record serialized as a single line of JSON
+};
+
+} // namespace apl
+
+#endif // _APL_INPUT_RECORDER_H
@@ -0,0 +1,99 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef _APL_INPUT_REPLAYER_H
+#define _APL_INPUT_REPLAYER_H
+
+#include <string>
+#include <vector>
+
+#include "rapidjson/document.h"
+
+#include "apl/common.h"
+
+namespace apl {
+
+/**
+ * Drives a RootContext from a trace captured by an InputRecorder.  The replayer is intended for
+ * headless use: inflate the same document with the same RootConfig and Metrics as the recorded
+ * session, install InputReplayer::textMeasurement() so that layout does not depend on the fonts
+ * of the machine doing the replay, and then call replay().
+ *
+ *     auto replayer = InputReplayer::create(trace);
+ *     replayer->replay(root);
+ *
+ * Events and dirty properties raised by the RootContext are not consumed by the replayer; the
+ * caller is free to drain them between steps.
+ */
+class InputReplayer {
+public:
+    /**
+     * Parse a trace.
+     * @param trace Newline-separated JSON records, as produced by InputRecorder::serialize().
+     * @return The replayer, or nullptr if the trace could not be parsed.
+     */
+    static InputReplayerPtr create(const std::string& trace);
+
+    /**
+     * @return A text measurement object that lays out every character as a fixed 10x10 dp cell.
+     */
+    static TextMeasurementPtr textMeasurement();
+
+    /**
+     * Apply the next record in the trace to the root context.
+     * @param root The root context to drive.
+     * @return True if a record was applied; false if the trace is exhausted.
+     */
+    bool step(const RootContextPtr& root);
+
+    /**
+     * Apply all of the remaining records in the trace to the root context.
+     * @param root The root context to drive.
+     */
+    void replay(const RootContextPtr& root);
+
+    /**
+     * Rewind to the start of the trace.
+     */
+    void rewind() { mPosition = 0; }
+
+    /**
+     * @return The number of records in the trace.
+     */
+    size_t size() const { return mRecords.size(); }
+
+    /**
+     * @return The index of the next record to be applied.
+     */
+    size_t position() const { return mPosition; }
+
+    /**
+     * @return True if all records have been applied.
+     */
+    bool done() const { return mPosition >= mRecords.size(); }
+
+    /**
+     * Use InputReplayer::create() instead.
+     */
+    explicit InputReplayer(std::vector<rapidjson::Document>&& records) : mRecords(std::move(records)) {}
+
+private:
+    std::vector<rapidjson::Document> mRecords;
+    size_t mPosition = 0;
+};
+
+} // namespace apl
+
+#endif // _APL_INPUT_REPLAYER_H
@@ -144,6 +144,13 @@ public:
      */
     void addPostProcess(const CoreComponentPtr& component, PropertyKey key, const Object& value );
 
+    /**
+     * Schedule CoreComponent::processPendingLayoutChanges for this component in the next layout pass.
+     * Multiple requests before the layout pass are coalesced into a single call.
+     * @param component The component
+     */
+    void requestLayoutChanges(const CoreComponentPtr& component);
+
     /**
      * Notify LayoutManager that additional processing pass required after layout.
      */
@@ -158,6 +165,7 @@ private:
 
     const RootContextData& mCore;
     std::set<CoreComponentPtr> mPendingLayout;
+    std::set<CoreComponentPtr> mPendingLayoutChanges;
     Size mConfiguredSize;
     bool mTerminated = false;
     bool mInLayout = false;    // Guard against recursive calls to layout
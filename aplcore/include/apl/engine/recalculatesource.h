@@ -36,8 +36,9 @@ public:
      * Add a dependant object that is downstream of this object.
      * @param key The key of the local element.  When this element is changed, the downstream dependant should recalculate.
      * @param dependant The dependant object connecting to the downstream dependant object.
+     * @return True if the dependant was added, false if the pair already exists.
      */
-    void addDownstream(T key, const std::shared_ptr<Dependant>& dependant) {
+    bool addDownstream(T key, const std::shared_ptr<Dependant>& dependant) {
         // For now, we strip off the "/" section of the keys
         auto name = key.substr(0, key.find("/", 0));
 
@@ -50,7 +51,7 @@ public:
             if (ptr) {
                 if (ptr == dependant) {
                     LOG(LogLevel::kWarn) << "Attempted to add duplicate pair " << key;
-                    return;    // This pair already exists
+                    return false;    // This pair already exists
                 }
                 it++;
             } else {
@@ -60,6 +61,7 @@ public:
         }
 
         mDownstream.emplace(name, dependant);
+        return true;
     }
 
     /**
@@ -99,6 +101,21 @@ public:
         }
     }
 
+    /**
+     * Visit each live downstream dependant connected to this key.
+     * @param key The key
+     * @param visitor A function called with each dependant.
+     */
+    template<class Visitor>
+    void visitDownstream(T key, Visitor visitor) const {
+        auto dependants = mDownstream.equal_range(key);
+        for (auto it = dependants.first ; it != dependants.second ; it++) {
+            auto ptr = it->second.lock();
+            if (ptr)
+                visitor(*ptr);
+        }
+    }
+
     /**
      * Return how many downstream dependants are connected to this key.
      * @param key The key
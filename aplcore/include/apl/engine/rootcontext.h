@@ -481,6 +481,18 @@ public:
      */
     void mediaLoadFailed(const std::string& source, int errorCode = -1, const std::string& error = std::string());
 
+    /**
+     * Attach an input recorder.  Every subsequent call into this root context from the view host
+     * is appended to the recorder so that the session can be replayed with an InputReplayer.
+     * @param recorder The recorder, or nullptr to stop recording.
+     */
+    void setInputRecorder(const InputRecorderPtr& recorder) { mInputRecorder = recorder; }
+
+    /**
+     * @return The attached input recorder, or nullptr if none is attached.
+     */
+    const InputRecorderPtr& getInputRecorder() const { return mInputRecorder; }
+
     friend streamer& operator<<(streamer& os, const RootContext& root);
 
 private:
@@ -503,6 +515,7 @@ private:
     apl_duration_t mLocalTimeAdjustment;
     ConfigurationChange mActiveConfigurationChanges;
     DisplayState mDisplayState;
+    InputRecorderPtr mInputRecorder;
 };
 
 } // namespace apl
@@ -36,6 +36,7 @@
 #include "apl/focus/focusmanager.h"
 #include "apl/livedata/livedatamanager.h"
 #include "apl/media/mediamanager.h"
+#include "apl/media/mediaplayerpool.h"
 #include "apl/primitives/textmeasurerequest.h"
 #include "apl/primitives/size.h"
 #include "apl/time/sequencer.h"
@@ -93,6 +94,7 @@ public:
     LayoutManager& layoutManager() const { return *mLayoutManager; }
     MediaManager& mediaManager() const { return *mConfig.getMediaManager(); }
     MediaPlayerFactory& mediaPlayerFactory() const { return *mConfig.getMediaPlayerFactory(); }
+    MediaPlayerPool& mediaPlayerPool() const { return *mMediaPlayerPool; }
 
     const YGConfigRef& ygconfig() const { return mYGConfigRef; }
     CoreComponentPtr top() const { return mTop; }
@@ -180,6 +182,7 @@ private:
     std::unique_ptr<LiveDataManager> mDataManager;
     std::unique_ptr<ExtensionManager> mExtensionManager;
     std::unique_ptr<LayoutManager> mLayoutManager;
+    std::unique_ptr<MediaPlayerPool> mMediaPlayerPool;  // Must outlive mTop
     YGConfigRef mYGConfigRef;
     TextMeasurementPtr mTextMeasurement;
     CoreComponentPtr mTop;         // The top component
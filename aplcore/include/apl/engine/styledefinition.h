@@ -56,6 +56,15 @@ public:
      */
     const StyleInstancePtr get(const ContextPtr& context, const State& state);
 
+    /**
+     * Return the set of component states this style can observe, including the styles it extends.  A state
+     * is observed if any "when" clause or value of the style refers to it.  Styles that don't observe a state
+     * evaluate to the same properties whether or not that state is set.
+     * @param context The data-binding context used to parse the style.
+     * @return A bit mask where bit N is set if the style observes StateProperty N.
+     */
+    unsigned int stateMask(const ContextPtr& context);
+
     /**
      * @return The provenance path of the style
      */
@@ -67,6 +76,8 @@ private:
     std::vector<StyleDefinitionPtr > mExtends;   // Named styles we extend
     std::vector<const rapidjson::Value *> mBlocks;   // Ordered list of blocks to evaluate
     std::map<State, StyleInstancePtr> mCache;          // State cache of results
+    unsigned int mStateMask = 0;
+    bool mStateMaskValid = false;
 };
 
 } // namespace apl
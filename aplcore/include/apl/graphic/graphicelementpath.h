@@ -17,6 +17,7 @@
 #define _APL_GRAPHIC_ELEMENT_PATH_H
 
 #include "apl/graphic/graphicelement.h"
+#include "apl/graphic/pathgeometry.h"
 
 namespace apl {
 
@@ -29,9 +30,25 @@ public:
     GraphicElementType getType() const override { return kGraphicElementTypePath; }
     std::string toDebugString() const override { return "GraphicElementPath<>"; }
 
+    /**
+     * @return The parsed geometry of the current path data.  The geometry is cached until the
+     *         path data changes.
+     */
+    PathGeometryPtr getGeometry() const;
+
+    /**
+     * @return The visible dashes of the stroke, measured along the path.  This applies the
+     *         strokeDashArray and strokeDashOffset, scaled by pathLength if it has been set.
+     */
+    std::vector<PathInterval> getDashIntervals() const;
+
 protected:
     const GraphicPropDefSet& propDefSet() const override;
     bool initialize(const GraphicPtr& graphic, const Object& json) override;
+
+private:
+    mutable PathGeometryPtr mGeometry;
+    mutable std::string mGeometryPathData;
 };
 
 } // namespace apl
@@ -0,0 +1,167 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef _APL_PATH_GEOMETRY_H
+#define _APL_PATH_GEOMETRY_H
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "apl/primitives/point.h"
+#include "apl/primitives/rect.h"
+
+namespace apl {
+
+class PathGeometry;
+using PathGeometryPtr = std::shared_ptr<const PathGeometry>;
+
+/**
+ * A start and end distance along a path, measured from the start of the path.
+ */
+using PathInterval = std::pair<float, float>;
+
+/**
+ * The parsed form of an AVG "pathData" string.  The path is parsed once into absolute line, quadratic and
+ * cubic segments (elliptical arcs are converted to cubics) and flattened into a polyline.  The tight bounds,
+ * the arc length and the cumulative length of every polyline vertex are calculated up front, so questions
+ * about the path do not require re-parsing the string.
+ *
+ * Parsing follows the SVG path grammar.  As in SVG, parsing stops at the first error and the path is
+ * rendered up to that point.
+ */
+class PathGeometry {
+public:
+    /**
+     * A flattened subpath.  Vertices [first, last] of the polyline belong to the subpath.
+     */
+    struct Subpath {
+        size_t first;
+        size_t last;
+        bool closed;
+    };
+
+    /**
+     * Parse a path.
+     * @param pathData The SVG-style path string.
+     * @param tolerance The maximum distance between a curve and its flattened polyline.
+     * @return The path geometry.  This is never null; a malformed string results in a shorter (or empty) path.
+     */
+    static PathGeometryPtr create(const std::string& pathData, float tolerance = 0.25f);
+
+    explicit PathGeometry(float tolerance) : mTolerance(tolerance) {}
+
+    /**
+     * @return True if the path does not draw anything.
+     */
+    bool empty() const { return mSubpaths.empty(); }
+
+    /**
+     * @return True if the entire path string was parsed.
+     */
+    bool valid() const { return mValid; }
+
+    /**
+     * @return The smallest rectangle containing the path.  Control points that lie outside of the curve
+     *         are not included.  Stroke width is not included.
+     */
+    const Rect& getBounds() const { return mBounds; }
+
+    /**
+     * @return The total length of the path.
+     */
+    float getLength() const { return mDistances.empty() ? 0 : mDistances.back(); }
+
+    /**
+     * @return The flattened polyline.  Use getSubpaths() to split it into separate subpaths.
+     */
+    const std::vector<Point>& getPoints() const { return mPoints; }
+
+    /**
+     * @return The flattened subpaths.  Subpaths consisting of a single "moveto" are not included.
+     */
+    const std::vector<Subpath>& getSubpaths() const { return mSubpaths; }
+
+    /**
+     * Find the point at a distance along the path.  This takes O(log n) for n polyline vertices.
+     * @param distance The distance from the start of the path.  This is clamped to the path length.
+     * @return The point.
+     */
+    Point getPointAtDistance(float distance) const;
+
+    /**
+     * Extract the polyline lying between two distances along the path.  Gaps between subpaths are skipped;
+     * the caller should split the range on subpath boundaries when drawing.
+     * @param start The starting distance.
+     * @param end The ending distance.
+     * @return The polyline, starting and ending exactly at the requested distances.
+     */
+    std::vector<Point> getSegment(float start, float end) const;
+
+    /**
+     * Calculate the visible dashes of the path.  Following SVG, the dash pattern restarts at the start
+     * of each subpath.  A pattern that is empty, has a negative value or sums to zero draws the entire path.
+     * Locating the first dash takes O(log m) for a pattern of m values; each dash after that is O(1).
+     * @param pattern The dash and gap lengths.  An odd-length pattern is repeated to make it even.
+     * @param offset The distance into the dash pattern at the start of each subpath.
+     * @param scale A scaling factor applied to the pattern and offset.  Used to support "pathLength".
+     * @return The visible intervals, measured along the path.
+     */
+    std::vector<PathInterval> getDashIntervals(const std::vector<float>& pattern, float offset,
+                                               float scale = 1.0f) const;
+
+    /**
+     * Check if a point falls inside the filled path.  Subpaths are implicitly closed.
+     * @param point The point to test.
+     * @param evenOdd If true, use the even-odd fill rule.  Otherwise use the non-zero winding rule.
+     * @return True if the point is inside.
+     */
+    bool contains(const Point& point, bool evenOdd = false) const;
+
+private:
+    friend class PathParser;
+
+    void moveTo(const Point& p);
+    void lineTo(const Point& p);
+    void quadTo(const Point& p1, const Point& p2);
+    void cubicTo(const Point& p1, const Point& p2, const Point& p3);
+    void close();
+    void finish(bool valid);
+
+    void addVertex(const Point& p);
+    void includeInBounds(float x, float y);
+    size_t locate(float distance) const;
+
+private:
+    float mTolerance;
+    bool mValid = true;
+
+    std::vector<Point> mPoints;       // Flattened polyline
+    std::vector<float> mDistances;    // Cumulative distance at each polyline vertex
+    std::vector<Subpath> mSubpaths;
+
+    Point mStart;                     // Start of the current subpath
+    Point mCurrent;                   // Current point
+    bool mOpen = false;               // True if the current subpath has at least one segment
+
+    float mMinX = 0, mMinY = 0, mMaxX = 0, mMaxY = 0;
+    bool mHasBounds = false;
+    Rect mBounds = Rect(0, 0, 0, 0);
+};
+
+} // namespace apl
+
+#endif // _APL_PATH_GEOMETRY_H
@@ -98,6 +98,9 @@ public:
      */
     virtual bool isPaginating() const { return false; }
 
+protected:
+    void recalculateDownstream(Context& context) override;
+
 private:
     void handleArrayMessage(const LiveArrayChange& change);
 
@@ -82,7 +82,7 @@ public:
     {
         auto context = mContext.lock();
         if (context)
-            context->recalculateDownstream(mKey, true);
+            recalculateDownstream(*context);
 
         for (const auto& m : mFlushCallbacks)
             m.second(mKey, *this);
@@ -123,6 +123,13 @@ protected:
     LiveDataObject(const ContextPtr& context, const std::string& key) : mContext(context), mKey(key) {}
     void markDirty();
 
+    /**
+     * Recalculate the dependants of this object in its data-binding context.  Subclasses limit this
+     * to the dependants referring to the members that have changed.
+     * @param context The data-binding context the object is registered in.
+     */
+    virtual void recalculateDownstream(Context& context) { context.recalculateDownstream(mKey, true); }
+
 protected:
     std::weak_ptr<Context> mContext;
     std::string mKey;
@@ -84,6 +84,9 @@ public:
      */
     const std::set<std::string>& getChanged();
 
+protected:
+    void recalculateDownstream(Context& context) override;
+
 private:
     void handleMapMessage(const LiveMapChange& change);
 
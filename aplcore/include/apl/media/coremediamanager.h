@@ -19,6 +19,7 @@
 #include <map>
 #include <memory>
 #include <set>
+#include <vector>
 
 #include "apl/media/mediamanager.h"
 
@@ -26,6 +27,10 @@ namespace apl {
 
 /**
  * The core media manager pushes events onto the event queue when media objects are requested.
+ * Pending requests are sent closest-to-the-viewport first.  RootProperty::kMaxMediaRequestsInFlight
+ * limits how many requests may be outstanding with the view host at once, and
+ * RootProperty::kMediaRequestCancelDistance holds back requests for distant media and cancels
+ * outstanding requests that are no longer needed.
  *
  * This media manager is not thread safe and should not be used by multiple view hosts (create one per view host).
  * This is the default media manager that will be instantiated in RootConfig if not overwritten.
@@ -40,6 +45,8 @@ public:
 
     void processMediaRequests(const ContextPtr& context) override;
 
+    void registerComponent(const MediaObjectPtr& mediaObject, const CoreComponentPtr& component) override;
+
     void mediaLoadComplete(const std::string& source,
                            bool isReady,
                            int errorCode = 0,
@@ -47,14 +54,24 @@ public:
 
     /**
      * Remove a URL from the map of media objects.  Note that this does not release any MediaObjects using that
-     * URL.  It only removes it from the known map maintained by the core media manager.
+     * URL.  It only removes it from the known map maintained by the core media manager.  If the media object
+     * was released while the view host was still loading it, a cancellation is queued for the next call to
+     * processMediaRequests.
      * @param url The URL to remove.
      */
     void removeMediaObject(const std::string& url);
 
 protected:
+    struct InFlight {
+        std::weak_ptr<MediaObject> object;
+        EventMediaType type;
+    };
+
     std::map<std::string, std::weak_ptr<MediaObject>> mObjectMap;
     std::set<std::weak_ptr<MediaObject>, std::owner_less<std::weak_ptr<MediaObject>>> mPending;
+    std::map<std::string, InFlight> mInFlight;  // Requested from the view host, not yet loaded
+    std::vector<std::pair<std::string, EventMediaType>> mReleased;  // Released while in flight
+    unsigned int mSequence = 0;
 };
 
 } // namespace apl
@@ -61,6 +61,14 @@ public:
      */
     virtual void processMediaRequests(const ContextPtr& context) {}
 
+    /**
+     * Associate a pending media object with a component that displays it.  A media manager that
+     * schedules requests may use the position of the component to favor media near the viewport.
+     * @param mediaObject The media object
+     * @param component The component that requested it
+     */
+    virtual void registerComponent(const MediaObjectPtr& mediaObject, const CoreComponentPtr& component) {}
+
     /**
      * Notify the manager about a media object which either loaded or failed to load.  This method
      * is not required.  It is called by RootContext::mediaLoaded() and RootContext::mediaLoadFailed().
@@ -0,0 +1,82 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef _APL_MEDIA_PLAYER_POOL_H
+#define _APL_MEDIA_PLAYER_POOL_H
+
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "apl/media/mediaplayer.h"
+#include "apl/utils/noncopyable.h"
+
+namespace apl {
+
+/**
+ * A per-document pool of media players.  Creating a media player is expensive on most view hosts because
+ * each one is backed by a decoder, so instead of releasing the player of a VideoComponent that goes away
+ * the pool keeps up to "maxIdle" players around and hands them to newly created VideoComponents.
+ *
+ * Pooled players are created with a callback that forwards to the currently bound owner.  When a player
+ * is returned to the pool it is halted, unbound and reset with an empty track list.  The new owner
+ * is expected to call setTrackList() and setAudioTrack() before using the player.
+ *
+ * When "maxIdle" is zero the pool is disabled: players are created directly by the factory and released
+ * when the owner is done with them.
+ */
+class MediaPlayerPool : public NonCopyable {
+public:
+    MediaPlayerPool(MediaPlayerFactoryPtr factory, int maxIdle);
+    ~MediaPlayerPool();
+
+    /**
+     * Retrieve a media player.  An idle pooled player is reused if one is available.
+     * @param callback The callback the media player should invoke with events.
+     * @return The media player.
+     */
+    MediaPlayerPtr acquire(MediaPlayerCallback callback);
+
+    /**
+     * The owner of a media player no longer needs it.  The player is kept for reuse if there is room
+     * in the pool; otherwise it is released.
+     * @param player The media player.
+     */
+    void release(const MediaPlayerPtr& player);
+
+    /**
+     * Release all idle media players held by the pool.
+     */
+    void clear();
+
+    /**
+     * @return The number of idle media players held by the pool.
+     */
+    size_t idleCount() const { return mIdle.size(); }
+
+private:
+    struct Binding {
+        MediaPlayerCallback callback;
+    };
+
+    MediaPlayerFactoryPtr mFactory;
+    size_t mMaxIdle;
+    std::map<const MediaPlayer*, std::shared_ptr<Binding>> mBindings;
+    std::vector<MediaPlayerPtr> mIdle;
+};
+
+} // namespace apl
+
+#endif // _APL_MEDIA_PLAYER_POOL_H
@@ -13,6 +13,7 @@
  * permissions and limitations under the License.
  */
 #include <vector>
+#include <bitset>
 #include <string>
 
 #include "apl/common.h"
@@ -30,6 +31,8 @@ public:
     bool isCharacterValid(const wchar_t& wc) const {
         return (wc <= mUpper && wc >= mLower);
     }
+    wchar_t lower() const { return mLower; }
+    wchar_t upper() const { return mUpper; }
 private:
     const wchar_t mLower;
     const wchar_t mUpper;
@@ -37,6 +40,15 @@ private:
 
 class CharacterRanges {
 public:
+    /**
+     * Return a compiled character ranges holder for a string expression.  Holders are shared between
+     * all callers using the same expression.
+     * @param session The logging session
+     * @param rangeExpression The character range expression.
+     * @return The character ranges holder.
+     */
+    static CharacterRangesPtr create(const SessionPtr &session, const std::string& rangeExpression);
+
     /**
      * Build a character ranges holder from a string expression
      *
@@ -50,7 +62,7 @@ public:
      * @param rangeExpression The character range expression.
      */
     CharacterRanges(const SessionPtr &session, const char *rangeExpression) :
-        mRanges(parse(session, rangeExpression)) {}
+        mRanges(parse(session, rangeExpression)) { compile(); }
 
     /**
      * Build a character ranges holder from a string expression
@@ -62,9 +74,32 @@ public:
 
     const std::vector<CharacterRangeData>& getRanges() const { return mRanges; }
 
+    /**
+     * @param wc The character to check.
+     * @return True if the character falls in one of the ranges.  All characters are valid when there
+     *         are no ranges.
+     */
+    bool isCharacterValid(wchar_t wc) const;
+
+    /**
+     * @param utf8String A UTF-8 encoded string.
+     * @return True if every character in the string is valid.  Malformed strings are not valid.
+     */
+    bool isValid(const std::string& utf8String) const;
+
+    /**
+     * @param utf8String A UTF-8 encoded string.
+     * @return The string with all invalid characters and malformed byte sequences removed.
+     */
+    std::string filter(const std::string& utf8String) const;
+
 private:
     static std::vector<CharacterRangeData> parse(const SessionPtr &session, const char* rangeExpression);
+    void compile();
+
     const std::vector<CharacterRangeData> mRanges;
+    std::vector<std::pair<wchar_t, wchar_t>> mIntervals;  // Sorted, non-overlapping, non-adjacent
+    std::bitset<128> mAscii;
 };
 } // namespace apl
 
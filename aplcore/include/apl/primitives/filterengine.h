@@ -0,0 +1,134 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef _APL_FILTER_ENGINE_H
+#define _APL_FILTER_ENGINE_H
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <vector>
+
+#include "apl/primitives/object.h"
+
+namespace apl {
+
+/**
+ * A simple raster image: 8-bit RGBA pixels with straight (non-premultiplied) alpha, stored row by
+ * row with no padding between rows.
+ */
+struct Bitmap {
+    Bitmap() = default;
+    Bitmap(int width, int height) : width(width), height(height), pixels(width * height * 4, 0) {}
+
+    /**
+     * @return The RGBA value of a pixel packed as 0xRRGGBBAA, matching apl::Color.
+     */
+    uint32_t getPixel(int x, int y) const {
+        const auto *p = &pixels[(y * width + x) * 4];
+        return (uint32_t(p[0]) << 24) | (uint32_t(p[1]) << 16) | (uint32_t(p[2]) << 8) | p[3];
+    }
+
+    /**
+     * Set the RGBA value of a pixel from a packed 0xRRGGBBAA value.
+     */
+    void setPixel(int x, int y, uint32_t color) {
+        auto *p = &pixels[(y * width + x) * 4];
+        p[0] = (color >> 24) & 0xff;
+        p[1] = (color >> 16) & 0xff;
+        p[2] = (color >> 8) & 0xff;
+        p[3] = color & 0xff;
+    }
+
+    int width = 0;
+    int height = 0;
+    std::vector<uint8_t> pixels;
+};
+
+using BitmapPtr = std::shared_ptr<const Bitmap>;
+
+/**
+ * Reference CPU implementation of the image Filter types (Blend, Blur, Color, Gradient, Grayscale,
+ * Noise and Saturate) and the AVG DropShadow graphic filter.  View hosts without a GPU compositor
+ * can use it to render filtered images, and headless tests can use it as a pixel-exact reference.
+ *
+ * Image filters follow the APL image array model: the array starts out holding the source images,
+ * each filter reads the images selected by its "source" (and "destination") index and appends its
+ * result, and the last image in the array is the output.  Negative indices count back from the end
+ * of the array.  A filter with an out-of-range index is skipped.  Generated images (Color and
+ * Gradient) have the size of the first source image; a Blend result has the size of its destination.
+ * Extension filters are not supported and are skipped.  As with CSS blur(), the Blur radius is used
+ * as the standard deviation of the Gaussian.
+ *
+ * Results are cached by the identity of the source bitmaps and the value of the filter chain, so
+ * re-rendering an unchanged image each frame is a lookup.
+ */
+class FilterEngine {
+public:
+    /**
+     * @param cacheSize The number of results kept for reuse.  0 disables the cache.
+     */
+    explicit FilterEngine(size_t cacheSize = 16) : mCacheSize(cacheSize) {}
+
+    /**
+     * Run a chain of image filters.
+     * @param sources The source images.
+     * @param filters An array of Filter objects, or a single Filter object.
+     * @param pixelsPerDp Scale applied to dimensions such as the blur radius.
+     * @param seed Seed for the Noise filter, so that the output is reproducible.
+     * @return The last image in the image array, or nullptr if it is empty.
+     */
+    BitmapPtr apply(const std::vector<BitmapPtr>& sources, const Object& filters,
+                    float pixelsPerDp = 1.0f, uint32_t seed = 0);
+
+    /**
+     * Run AVG graphic filters over a rendered graphic element.
+     * @param source The rendered element.
+     * @param filters An array of GraphicFilter objects, or a single GraphicFilter object.
+     * @param pixelsPerUnit Scale from AVG viewport units to pixels.
+     * @return The filtered image, which has the same size as the source.
+     */
+    BitmapPtr applyGraphicFilters(const BitmapPtr& source, const Object& filters, float pixelsPerUnit = 1.0f);
+
+    /**
+     * @return The number of results currently cached.
+     */
+    size_t cached() const { return mCache.size(); }
+
+    /**
+     * Release all cached results.
+     */
+    void clearCache() { mCache.clear(); }
+
+private:
+    struct CacheEntry {
+        std::vector<BitmapPtr> sources;
+        Object filters;
+        float scale;
+        uint32_t seed;
+        BitmapPtr result;
+    };
+
+    BitmapPtr findCached(const std::vector<BitmapPtr>& sources, const Object& filters, float scale, uint32_t seed);
+    void addCached(const std::vector<BitmapPtr>& sources, const Object& filters, float scale, uint32_t seed,
+                   const BitmapPtr& result);
+
+    size_t mCacheSize;
+    std::list<CacheEntry> mCache;  // Most recently used first
+};
+
+} // namespace apl
+
+#endif // _APL_FILTER_ENGINE_H
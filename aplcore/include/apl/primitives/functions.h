@@ -26,6 +26,18 @@ using UserFunction = std::function<Object(const ObjectArray&)>;
 
 extern void createStandardFunctions(Context& context);
 
+/**
+ * Calculate how coarsely a standard function observes a clock value.  The function is assumed to be
+ * called with the constant arguments "args" followed by the clock value divided by "divisor".  For example,
+ * Time.minutes(localTime) only changes when localTime crosses a minute boundary and Math.floor(elapsedTime/500)
+ * only changes when elapsedTime crosses a multiple of 500.
+ * @param function The function being called.
+ * @param args The constant arguments passed ahead of the clock value.
+ * @param divisor The constant the clock value is divided by before being passed to the function.
+ * @return The granularity in milliseconds or 0 if the function is not known to quantize the clock value.
+ */
+extern apl_duration_t clockGranularity(const Object& function, const ObjectArray& args, apl_duration_t divisor);
+
 /**
  * Hold information about a callable function
  */
@@ -204,6 +204,14 @@ public:
      */
     float distanceTo(const Point& point) const;
 
+    /**
+     * Calculate the distance between this rectangle and another rectangle.  If the
+     * rectangles touch or overlap, the distance is zero.
+     * @param other The other rectangle
+     * @return The Euclidean distance between the closest edges of the rectangles
+     */
+    float distanceTo(const Rect& other) const;
+
     /**
      * Get rect area value.
      * @return rect area.
@@ -323,6 +323,14 @@ template<> struct action<millisecond>
 
 extern std::string timeToString(const std::string& format, double time);
 
+/**
+ * Calculate the smallest time interval that a format string can resolve.  For example, "HH:mm" only
+ * changes once per minute and returns 60000.
+ * @param format The time format string.
+ * @return The granularity in milliseconds.
+ */
+extern apl_duration_t timeFormatGranularity(const std::string& format);
+
 } // namespace timegrammar
 
 } // namespace apl
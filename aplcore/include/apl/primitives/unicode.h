@@ -37,6 +37,25 @@ int utf8StringLength(const std::string& utf8String);
  */
 std::string utf8StringSlice(const std::string& utf8String, int start, int end = std::numeric_limits<int>::max());
 
+/**
+ * Convert a UTF-8 string to upper case using the Unicode case mappings, including the multi-character
+ * mappings (for example, "ß" becomes "SS") and the Turkish, Azeri and Lithuanian rules.
+ * Malformed bytes are copied unchanged.
+ * @param utf8String A reference to a std::string holding UTF-8 data
+ * @param locale The locale, for example "tr-TR".  Only the language part is used.
+ * @return The upper case string.
+ */
+std::string utf8ToUpper(const std::string& utf8String, const std::string& locale = "");
+
+/**
+ * Convert a UTF-8 string to lower case using the Unicode case mappings, including the Greek final
+ * sigma rule and the Turkish, Azeri and Lithuanian rules.  Malformed bytes are copied unchanged.
+ * @param utf8String A reference to a std::string holding UTF-8 data
+ * @param locale The locale, for example "tr-TR".  Only the language part is used.
+ * @return The lower case string.
+ */
+std::string utf8ToLower(const std::string& utf8String, const std::string& locale = "");
+
 } // namespace apl
 
 #endif // _APL_UNICODE_H
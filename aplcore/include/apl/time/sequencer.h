@@ -46,7 +46,9 @@ public:
 
     /**
      * Convenience routine that takes an array object of commands and a data-binding context,
-     * inflates an ArrayCommand, and then executes it.
+     * inflates an ArrayCommand, and then executes it.  In fast mode the commands are inflated
+     * and run directly without an enclosing ArrayCommand; actions are only allocated for commands
+     * that do not complete synchronously.
      *
      * @param commands An array of commands to execute.
      * @param context The data-binding context.
@@ -161,6 +163,10 @@ public:
 
 private:
     void executeFast(const CommandPtr& commandPtr);
+    void executeCommandsFast(const Object& commands,
+                             size_t startIndex,
+                             const ContextPtr& context,
+                             const CoreComponentPtr& baseComponent);
 
     bool mTerminated;
     const std::shared_ptr<TimeManager> mTimeManager;
@@ -36,7 +36,7 @@ public:
      * Constructor. Do not use directly, see AutoScroller::make.
      */
     AutoScroller(const ScrollablePtr& scrollable, FinishFunc finish);
-    virtual ~AutoScroller() = default;
+    virtual ~AutoScroller();
 
     /**
      * Make scroller from starting velocity.
@@ -87,11 +87,7 @@ protected:
      */
     virtual void update(const ScrollablePtr& scrollable, apl_duration_t offset) = 0;
 
-    void finish()
-    {
-        mFinished = true;
-        mOnFinish();
-    }
+    void finish();
 
 private:
     std::weak_ptr<ScrollableComponent> mScrollable;
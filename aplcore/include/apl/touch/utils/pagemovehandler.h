@@ -36,6 +36,18 @@ enum PageMoveDrawOrder {
     kPageMoveDrawOrderHigherBelow,
 };
 
+/**
+ * Phase of a host composited page transition, see RootConfig::kExperimentalFeatureHostPageTransitions.
+ */
+enum PageTransitionPhase {
+    /// The pages follow the pointer, the viewhost derives the amount from the pointer position.
+    kPageTransitionPhaseDrag,
+    /// The remainder of a gesture is animated from startAmount to endAmount.
+    kPageTransitionPhaseSettle,
+    /// A page change by command is animated from startAmount to endAmount.
+    kPageTransitionPhaseAnimate,
+};
+
 /**
  * Container for pageMoveHandler definition. Here mainly for modularity purposes.
  */
@@ -83,6 +95,24 @@ public:
      */
     bool isDefault() const { return mCommands.isNull(); }
 
+    /**
+     * @return true if this default handler leaves the frame-by-frame animation of the pages to the
+     *         viewhost, see RootConfig::kExperimentalFeatureHostPageTransitions.
+     */
+    bool isHostComposited() const { return mTransition != nullptr; }
+
+    /**
+     * Describe a phase of a host composited transition. Each call creates a new descriptor, so that
+     * descriptors already published on the pager are never changed.
+     * @param phase transition phase.
+     * @param startAmount move amount the phase starts at.
+     * @param endAmount move amount the phase ends at.
+     * @param duration duration of the phase in milliseconds, 0 when driven by the pointer.
+     * @return the page transition descriptor, or null if not host composited.
+     */
+    Object getTransition(PageTransitionPhase phase, float startAmount, float endAmount,
+                         apl_duration_t duration) const;
+
     /**
      * Execute PageMoveHandler.
      * @param component parent pager component.
@@ -126,6 +156,17 @@ private:
             float amount,
             const CoreComponentPtr& currentChild,
             const CoreComponentPtr& nextChild);
+    static std::pair<float, float> getPageShift(
+            const PagerPtr& component,
+            bool comeIn,
+            bool fromLeft);
+    static ObjectMapPtr describeTransition(
+            const PagerPtr& component,
+            SwipeDirection swipeDirection,
+            PageDirection pageDirection,
+            const CoreComponentPtr& currentChild,
+            const CoreComponentPtr& nextChild,
+            bool fromLeft);
 
     Object mCommands;
     PageMoveDrawOrder mDrawOrder;
@@ -138,6 +179,9 @@ private:
     // Transforms for default animation handling
     ITPtr mCurrentPageTransform;
     ITPtr mTargetPageTransform;
+
+    // Phase independent part of the descriptor for host composited default animation handling
+    ObjectMapPtr mTransition;
 };
 
 }  // namespace apl
@@ -59,6 +59,17 @@ public:
      */
     apl_duration_t getDuration() const override { return mDuration; }
 
+    /**
+     * @return Scroll velocity over the last update, in dp per millisecond.
+     */
+    Point getVelocity() const { return mVelocity; }
+
+    /**
+     * @return Scroll position the scroller is expected to come to rest at. A fling projects it from its starting
+     *         velocity, so it may lie past the end of the content. Other scrolls limit it to the available range.
+     */
+    Point getDestination() const { return mDestination; }
+
 protected:
     void update(const std::shared_ptr<ScrollableComponent>& scrollable, apl_duration_t offset) override;
 
@@ -70,7 +81,11 @@ private:
     Point mScrollStartPosition;
     Point mLastScrollPosition;
     Point mEndTarget;
+    Point mVelocity;
+    Point mDestination;
     apl_duration_t mDuration;
+    apl_duration_t mLastOffset;
+    bool mProjectDestination = false;
 };
 
 } // namespace apl
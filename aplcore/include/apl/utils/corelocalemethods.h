@@ -17,17 +17,29 @@
 #define _APL_CORE_LOCALE_METHODS_H
 
 #include "apl/utils/localemethods.h"
+#include "apl/utils/lrucache.h"
 
 namespace apl {
 
+/**
+ * Default locale methods.  Case conversion uses the built-in Unicode case mapping tables, so hosts
+ * do not need to call out to a platform library.  Results for non-ASCII strings are cached, because
+ * the same strings are typically converted again each time a data-bound item is inflated.
+ */
 class CoreLocaleMethods : public LocaleMethods {
 public:
+    CoreLocaleMethods() : mUpperCache(CACHE_SIZE), mLowerCache(CACHE_SIZE) {}
     ~CoreLocaleMethods() override = default;
 
     std::string toUpperCase( const std::string& value, const std::string& locale ) override;
 
     std::string toLowerCase( const std::string& value, const std::string& locale ) override;
 
+private:
+    static const size_t CACHE_SIZE = 256;
+
+    LruCache<std::string, std::string> mUpperCache;
+    LruCache<std::string, std::string> mLowerCache;
 };
 
 } // namespace apl
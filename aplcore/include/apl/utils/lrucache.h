@@ -16,6 +16,7 @@
 #ifndef _APL_LRU_CACHE_H
 #define _APL_LRU_CACHE_H
 
+#include <cassert>
 #include <list>
 #include <unordered_map>
 
@@ -42,14 +42,20 @@ ActionableComponent::propDefSet() const {
 
 void
 ActionableComponent::executeOnBlur() {
-    auto command = getCalculated(kPropertyOnBlur);
+    auto& command = getCalculated(kPropertyOnBlur);
+    if (command.empty())
+        return;
+
     auto eventContext = createDefaultEventContext("Blur");
     mContext->sequencer().executeCommands(command, eventContext, shared_from_corecomponent(), true);
 }
 
 void
 ActionableComponent::executeOnFocus() {
-    auto command = getCalculated(kPropertyOnFocus);
+    auto& command = getCalculated(kPropertyOnFocus);
+    if (command.empty())
+        return;
+
     auto eventContext = createDefaultEventContext("Focus");
     mContext->sequencer().executeCommands(command, eventContext, shared_from_corecomponent(), true);
 }
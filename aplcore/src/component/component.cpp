@@ -110,6 +110,18 @@ Component::isCharacterValid(const wchar_t wc) const {
     return false;
 }
 
+bool
+Component::isTextValid(const std::string& text) const {
+    LOG(LogLevel::kError) << "isTextValid called for component that does not support it.";
+    return false;
+}
+
+std::string
+Component::filterText(const std::string& text) const {
+    LOG(LogLevel::kError) << "filterText called for component that does not support it.";
+    return "";
+}
+
 streamer&
 operator<<(streamer& os, const Component& component)
 {
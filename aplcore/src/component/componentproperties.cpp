@@ -417,6 +417,7 @@ Bimap<int, std::string> sComponentPropertyBimap = {
     {kPropertyPageDirection,           "pageDirection"},
     {kPropertyPageId,                  "pageId"},
     {kPropertyPageIndex,               "pageIndex"},
+    {kPropertyPageTransition,          "_pageTransition"},
     {kPropertyPlayingState,            "playingState"},
     {kPropertyPosition,                "position"},
     {kPropertyPreserve,                "preserve"},
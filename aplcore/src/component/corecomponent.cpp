@@ -30,6 +30,7 @@
 #include "apl/engine/hovermanager.h"
 #include "apl/engine/keyboardmanager.h"
 #include "apl/engine/layoutmanager.h"
+#include "apl/engine/styles.h"
 #include "apl/focus/focusmanager.h"
 #include "apl/livedata/layoutrebuilder.h"
 #include "apl/livedata/livearray.h"
@@ -1152,6 +1153,27 @@ CoreComponent::updateStyle()
     }
 }
 
+void
+CoreComponent::updateStyleForStates(unsigned int changedStates)
+{
+    if (isStyleSensitiveTo(changedStates)) {
+        updateStyle();
+        return;
+    }
+
+    for (const auto& child : mChildren) {
+        if (child->mInheritParentState)
+            child->updateStyleForStates(changedStates);
+    }
+}
+
+bool
+CoreComponent::isStyleSensitiveTo(unsigned int changedStates) const
+{
+    auto definition = mContext->styles()->getStyleDefinition(mStyle);
+    return definition && (definition->stateMask(mContext) & changedStates) != 0;
+}
+
 /**
  * Update state of the component.  This may trigger style changes locally and in children
  * Do NOT call this method directly to set the CHECKED or DISABLED states.  Those calls should
@@ -1169,6 +1191,7 @@ CoreComponent::setState( StateProperty stateProperty, bool value )
 
     if (mState.set(stateProperty, value)) {
         auto self = shared_from_corecomponent();
+        auto changedStates = 1u << stateProperty;
         if (stateProperty == kStateChecked || stateProperty == kStateFocused
             || stateProperty == kStateDisabled) {
             setVisualContextDirty();
@@ -1176,8 +1199,10 @@ CoreComponent::setState( StateProperty stateProperty, bool value )
 
         if (stateProperty == kStateDisabled) {
             if (value) {
-                mState.set(kStatePressed, false);
-                mState.set(kStateHover, false);
+                if (mState.set(kStatePressed, false))
+                    changedStates |= 1u << kStatePressed;
+                if (mState.set(kStateHover, false))
+                    changedStates |= 1u << kStateHover;
                 auto& fm = mContext->focusManager();
                 if (fm.getFocus() == self) {
                     auto next = fm.find(kFocusDirectionForward);
@@ -1197,7 +1222,7 @@ CoreComponent::setState( StateProperty stateProperty, bool value )
             mContext->hoverManager().componentToggledDisabled(self);
         }
 
-        updateStyle();
+        updateStyleForStates(changedStates);
     }
 }
 
@@ -2015,15 +2040,21 @@ CoreComponent::isDisplayable() const {
 
 void
 CoreComponent::executeOnCursorEnter() {
+    auto& command = getCalculated(kPropertyOnCursorEnter);
+    if (command.empty())
+        return;
+
     auto eventContext = createDefaultEventContext("CursorEnter");
-    auto command = getCalculated(kPropertyOnCursorEnter);
     mContext->sequencer().executeCommands(command, eventContext, shared_from_corecomponent(), true);
 }
 
 void
 CoreComponent::executeOnCursorExit() {
+    auto& command = getCalculated(kPropertyOnCursorExit);
+    if (command.empty())
+        return;
+
     auto eventContext = createDefaultEventContext("CursorExit");
-    auto command = getCalculated(kPropertyOnCursorExit);
     mContext->sequencer().executeCommands(command, eventContext, shared_from_corecomponent(), true);
 }
 
@@ -2150,6 +2181,9 @@ CoreComponent::executeEventHandler(const std::string& event, const Object& comma
         if (!fastMode)
             mContext->sequencer().reset();
 
+        if (commands.empty())
+            return;
+
         ContextPtr eventContext = createEventContext(event, optional);
         mContext->sequencer().executeCommands(
             commands,
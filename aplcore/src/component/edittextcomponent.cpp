@@ -154,9 +154,11 @@ void
 EditTextComponent::update(UpdateType type, float value)
 {
     if (type == kUpdateSubmit) {
-        ContextPtr eventContext = createEventContext("Submit");
-        auto commands = getCalculated(kPropertyOnSubmit);
-        mContext->sequencer().executeCommands(commands, eventContext, shared_from_corecomponent(), false);
+        auto& commands = getCalculated(kPropertyOnSubmit);
+        if (!commands.empty()) {
+            ContextPtr eventContext = createEventContext("Submit");
+            mContext->sequencer().executeCommands(commands, eventContext, shared_from_corecomponent(), false);
+        }
 
     } else
     CoreComponent::update(type, value);
@@ -174,9 +176,11 @@ EditTextComponent::update(UpdateType type, const std::string& value)
             } else {
                 mCalculated.set(kPropertyText, value);
             }
-            ContextPtr eventContext = createEventContext("TextChange");
-            auto commands = getCalculated(kPropertyOnTextChange);
-            mContext->sequencer().executeCommands(commands, eventContext, shared_from_corecomponent(), false);
+            auto& commands = getCalculated(kPropertyOnTextChange);
+            if (!commands.empty()) {
+                ContextPtr eventContext = createEventContext("TextChange");
+                mContext->sequencer().executeCommands(commands, eventContext, shared_from_corecomponent(), false);
+            }
         }
     } else
         CoreComponent::update(type, value);
@@ -187,19 +191,29 @@ EditTextComponent::isCharacterValid(const wchar_t wc) const
 {
     if (mCharacterRangesPtr == nullptr) return true;
 
-    std::vector<CharacterRangeData> validRanges = mCharacterRangesPtr->getRanges();
-    if (validRanges.empty()) return true;
+    return mCharacterRangesPtr->isCharacterValid(wc);
+}
 
-    for (auto& range : validRanges) {
-        if (range.isCharacterValid(wc)) return true;
-    }
-    return false;
+bool
+EditTextComponent::isTextValid(const std::string& text) const
+{
+    if (mCharacterRangesPtr == nullptr) return true;
+
+    return mCharacterRangesPtr->isValid(text);
+}
+
+std::string
+EditTextComponent::filterText(const std::string& text) const
+{
+    if (mCharacterRangesPtr == nullptr) return text;
+
+    return mCharacterRangesPtr->filter(text);
 }
 
 void EditTextComponent::parseValidCharactersProperty()
 {
-    mCharacterRangesPtr = std::make_shared<CharacterRanges>(CharacterRanges(getContext()->session(),
-            mCalculated.get(kPropertyValidCharacters).asString()));
+    mCharacterRangesPtr = CharacterRanges::create(getContext()->session(),
+            mCalculated.get(kPropertyValidCharacters).asString());
 }
 
 PointerCaptureStatus
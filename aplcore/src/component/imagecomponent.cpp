@@ -130,19 +130,23 @@ ImageComponent::onFail(const MediaObjectPtr& mediaObject)
 {
     if (mOnLoadOnFailReported)
         return;
+    mOnLoadOnFailReported = true;
+
     auto component = getComponent();
+    auto& commands = component->getCalculated(kPropertyOnFail);
+    if (commands.empty())
+        return;
+
     auto errorData = std::make_shared<ObjectMap>();
     errorData->emplace("value", mediaObject->url());
     errorData->emplace("error", mediaObject->errorDescription());
     errorData->emplace("errorCode", mediaObject->errorCode());
-    auto& commands = component->getCalculated(kPropertyOnFail);
     auto eventContext = component->createEventContext("Fail", errorData);
     component->getContext()->sequencer().executeCommands(
         commands,
         eventContext,
         component->shared_from_corecomponent(),
         true);
-    mOnLoadOnFailReported = true;
 }
 
 void
@@ -150,14 +154,18 @@ ImageComponent::onLoad()
 {
     if (mOnLoadOnFailReported)
         return;
+    mOnLoadOnFailReported = true;
+
     auto component = getComponent();
     auto& commands = component->getCalculated(kPropertyOnLoad);
+    if (commands.empty())
+        return;
+
     component->getContext()->sequencer().executeCommands(
         commands,
         component->createEventContext("Load"),
         component->shared_from_corecomponent(),
         true);
-    mOnLoadOnFailReported = true;
 }
 
 } // namespace apl
@@ -71,6 +71,7 @@ MediaComponentTrait::ensureMediaRequested()
         auto mediaObject = context->mediaManager().request(m.getUrl(), mediaType(), m.getHeaders());
         MediaObject::CallbackID callbackToken = 0;
         if (mediaObject->state() == MediaObject::kPending) {
+            context->mediaManager().registerComponent(mediaObject, component);
             auto weak = std::weak_ptr<CoreComponent>(component);
             callbackToken = mediaObject->addCallback([weak](const MediaObjectPtr& mediaObjectPtr) {
                 auto self = weak.lock();
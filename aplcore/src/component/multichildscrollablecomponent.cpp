@@ -536,9 +536,10 @@ MultiChildScrollableComponent::trimScroll(const Point& point)
 
         float bottom = innerBounds.getBottom();
         float maxY = 0;
+        attachChildrenToCover(zeroAnchorIdx, y + innerBounds.getHeight(), false);
 
         // Ensure children until they cover the sequence.
-        for (int i = zeroAnchorIdx ; i<mChildren.size() ; i++) {
+        for (int i = coverageStartIndex(zeroAnchorIdx) ; i<mChildren.size() ; i++) {
             const auto& child = mChildren.at(i);
             layoutChildIfRequired(child, i, false, false);
             maxY = std::max(maxY, nonNegative(child->getCalculated(kPropertyBounds).getRect().getBottom() - bottom));
@@ -564,9 +565,10 @@ MultiChildScrollableComponent::trimScroll(const Point& point)
 
         float right = innerBounds.getRight();
         float maxX = 0;
+        attachChildrenToCover(zeroAnchorIdx, x + innerBounds.getWidth(), true);
 
         // Ensure children until they cover the sequence.
-        for (int i = zeroAnchorIdx ; i<mChildren.size(); i++) {
+        for (int i = coverageStartIndex(zeroAnchorIdx) ; i<mChildren.size(); i++) {
             const auto& child = mChildren.at(i);
             layoutChildIfRequired(child, i, true, false);
             maxX = std::max(maxX, nonNegative(child->getCalculated(kPropertyBounds).getRect().getRight() - right));
@@ -593,9 +595,10 @@ MultiChildScrollableComponent::trimScroll(const Point& point)
 
         float left = innerBounds.getLeft();
         float maxX = 0;
+        attachChildrenToCover(zeroAnchorIdx, x - innerBounds.getWidth(), true);
 
         // Ensure children until they cover the sequence.
-        for (int i = zeroAnchorIdx ; i<mChildren.size(); i++) {
+        for (int i = coverageStartIndex(zeroAnchorIdx) ; i<mChildren.size(); i++) {
             const auto& child = mChildren.at(i);
             layoutChildIfRequired(child, i, true, false);
             maxX = std::min(maxX, nonPositive(child->getCalculated(kPropertyBounds).getRect().getLeft() - left));
@@ -836,6 +839,45 @@ MultiChildScrollableComponent::runLayoutHeuristics(size_t anchorIdx, float child
     if (attached) relayoutInPlace(useDirtyFlag, first);
 }
 
+/**
+ * Children are laid out in order, so the furthest child reached so far is the last ensured child that takes up
+ * space.  Checking coverage from there avoids revisiting every child from the anchor on each scroll update.
+ */
+int
+MultiChildScrollableComponent::coverageStartIndex(int anchorIdx) const
+{
+    auto idx = std::max<int>(anchorIdx, mEnsuredChildren.upperBound());
+    while (idx > anchorIdx && mChildren.at(idx)->getCalculated(kPropertyDisplay).getInteger() == kDisplayNone)
+        idx--;
+    return idx;
+}
+
+/**
+ * Attach the children estimated to cover the provided distance from the anchor in one go, so that a long scroll
+ * runs a single layout pass instead of one per child. trimScroll() verifies coverage from the last ensured child.
+ */
+void
+MultiChildScrollableComponent::attachChildrenToCover(size_t anchorIdx, float distance, bool useDirtyFlag)
+{
+    if (mChildren.at(anchorIdx)->getCalculated(kPropertyBounds).empty())
+        return;
+
+    auto toCover = static_cast<int>(std::min(anchorIdx + estimateChildrenToCover(distance, anchorIdx), mChildren.size()));
+    auto attached = false;
+    for (int i = mEnsuredChildren.upperBound() + 1; i < toCover; i++) {
+        auto child = mChildren.at(i);
+        if (!child->isAttached() || child->getCalculated(kPropertyBounds).empty()) {
+            attached = true;
+            ensureChildAttached(child, i);
+            if (i > 0 && childrenUseSpacingProperty()) {
+                child->fixSpacing();
+            }
+        }
+    }
+
+    if (attached) relayoutInPlace(useDirtyFlag, false);
+}
+
 Point
 MultiChildScrollableComponent::getPaddedScrollPosition(LayoutDirection layoutDirection) const
 {
@@ -1024,10 +1066,55 @@ MultiChildScrollableComponent::onScrollPositionUpdated() {
 
     mChildrenVisibilityStale = true;
 
+    // Children swept past by a fling are on screen for a frame at most. Leave the cache and loading
+    // work to the predicted resting position, or to the backfill when the fling settles.
+    if (isPassingOver()) {
+        mScrollLayoutDeferred = true;
+        return;
+    }
+
     // Force figuring out what is on screen.
+    mScrollLayoutDeferred = false;
     processLayoutChanges(true, false);
 }
 
+void
+MultiChildScrollableComponent::setScrollProjection(const Point& destination)
+{
+    mHasScrollProjection = true;
+    mScrollProjection = destination;
+}
+
+void
+MultiChildScrollableComponent::clearScrollProjection()
+{
+    if (!mHasScrollProjection) return;
+
+    mHasScrollProjection = false;
+    if (mScrollLayoutDeferred) {
+        mScrollLayoutDeferred = false;
+        processLayoutChanges(true, false);
+    }
+}
+
+/*
+ * True if the current scroll position is further than the child cache away from the projected resting
+ * position of an ongoing fling.
+ */
+bool
+MultiChildScrollableComponent::isPassingOver() const
+{
+    if (!mHasScrollProjection) return false;
+
+    auto bounds = mCalculated.get(kPropertyBounds).getRect();
+    auto pageSize = isHorizontal() ? bounds.getWidth() : bounds.getHeight();
+    auto childCache = mContext->getRootConfig().getSequenceChildCache();
+    auto remaining = mScrollProjection - scrollPosition();
+    auto distance = std::abs(isHorizontal() ? remaining.getX() : remaining.getY());
+
+    return pageSize > 0 && distance > (childCache + 1) * pageSize;
+}
+
 float
 MultiChildScrollableComponent::getSnapOffsetForChild(
     const ComponentPtr& child,
@@ -211,7 +211,12 @@ PagerComponent::handleSetPage(int index, PageDirection direction, const ActionRe
     // Animate if required.
     std::weak_ptr<PagerComponent> weak_ptr(std::dynamic_pointer_cast<PagerComponent>(shared_from_this()));
     disableGestures();
-    if (mPageMoveHandler && !(mPageMoveHandler->isDefault() && skipDefaultAnimation)) {
+    if (mPageMoveHandler && mPageMoveHandler->isHostComposited() && !skipDefaultAnimation) {
+        // The viewhost animates the pages, the core only waits for the end of the transition
+        auto duration = getRootConfig().getDefaultPagerAnimationDuration();
+        publishPageTransition(kPageTransitionPhaseAnimate, 0.0f, 1.0f, duration);
+        mCurrentAnimation = Action::makeDelayed(getRootConfig().getTimeManager(), duration);
+    } else if (mPageMoveHandler && !(mPageMoveHandler->isDefault() && skipDefaultAnimation)) {
         auto duration = getRootConfig().getDefaultPagerAnimationDuration();
         mCurrentAnimation = Action::makeAnimation(getRootConfig().getTimeManager(),
             duration, [weak_ptr, duration](apl_duration_t offset){
@@ -249,10 +254,7 @@ PagerComponent::handleSetPage(int index, PageDirection direction, const ActionRe
                     self->mCurrentAnimation->terminate();
                     self->mCurrentAnimation = nullptr;
                 }
-                if (self->mPageMoveHandler) {
-                    self->mPageMoveHandler->reset();
-                    self->mPageMoveHandler = nullptr;
-                }
+                self->resetPageMoveHandler();
             }
         });
     }
@@ -261,9 +263,13 @@ PagerComponent::handleSetPage(int index, PageDirection direction, const ActionRe
 ActionPtr
 PagerComponent::executePageChangeEvent(bool fast)
 {
+    auto& commands = getCalculated(kPropertyOnPageChanged);
+    if (commands.empty())
+        return nullptr;
+
     ContextPtr eventContext = createEventContext("Page");
     return mContext->sequencer().executeCommands(
-            getCalculated(kPropertyOnPageChanged),
+            commands,
             eventContext,
             shared_from_corecomponent(),
             fast);  // If the user set the pager, run in fast mode.
@@ -292,6 +298,41 @@ PagerComponent::startPageMove(PageDirection direction, int currentPage, int targ
     mPageMoveHandler = PageMoveHandler::create(shared_from_corecomponent(), handlerObject,
         swipeDirection, direction, currentPage, targetPage);
     markDisplayedChildrenStale(true);
+
+    // Any transition of a previous move is stale, the caller publishes the first phase of this one
+    clearPageTransition();
+}
+
+bool
+PagerComponent::publishPageTransition(PageTransitionPhase phase, float startAmount, float endAmount,
+                                      apl_duration_t duration)
+{
+    if (!mPageMoveHandler || !mPageMoveHandler->isHostComposited())
+        return false;
+
+    mCalculated.set(kPropertyPageTransition, mPageMoveHandler->getTransition(phase, startAmount, endAmount, duration));
+    setDirty(kPropertyPageTransition);
+    return true;
+}
+
+void
+PagerComponent::clearPageTransition()
+{
+    if (!mCalculated.get(kPropertyPageTransition).isNull()) {
+        mCalculated.set(kPropertyPageTransition, Object::NULL_OBJECT());
+        setDirty(kPropertyPageTransition);
+    }
+}
+
+void
+PagerComponent::resetPageMoveHandler()
+{
+    if (mPageMoveHandler) {
+        mPageMoveHandler->reset();
+        mPageMoveHandler = nullptr;
+    }
+
+    clearPageTransition();
 }
 
 void
@@ -350,10 +391,7 @@ PagerComponent::endPageMove(bool fulfilled, const ActionRef& ref, bool fast)
     }
 
     markDisplayedChildrenStale(true);
-    if (mPageMoveHandler) {
-        mPageMoveHandler->reset();
-        mPageMoveHandler = nullptr;
-    }
+    resetPageMoveHandler();
     if (mCurrentAnimation) {
         mCurrentAnimation->terminate();
         mCurrentAnimation = nullptr;
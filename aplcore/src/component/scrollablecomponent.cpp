@@ -80,11 +80,14 @@ ScrollableComponent::setScrollPositionInternal(float value)
     // Only run the onScroll event handler once the component has been fully laid out.  This prevents the handler
     // from being run if the component was created with a scroll offset.
     if (allowEventHandlers()) {
-        ContextPtr eventContext = createEventContext("Scroll");
-        mContext->sequencer().executeCommands(getCalculated(kPropertyOnScroll),
-                                              eventContext,
-                                              shared_from_corecomponent(),
-                                              true);
+        auto& commands = getCalculated(kPropertyOnScroll);
+        if (!commands.empty()) {
+            ContextPtr eventContext = createEventContext("Scroll");
+            mContext->sequencer().executeCommands(commands,
+                                                  eventContext,
+                                                  shared_from_corecomponent(),
+                                                  true);
+        }
     }
     return true;
 }
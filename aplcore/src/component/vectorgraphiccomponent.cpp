@@ -17,6 +17,7 @@
 #include "apl/component/componentpropdef.h"
 #include "apl/component/vectorgraphiccomponent.h"
 #include "apl/component/yogaproperties.h"
+#include "apl/engine/layoutmanager.h"
 #include "apl/graphic/graphic.h"
 #include "apl/media/mediamanager.h"
 #include "apl/media/mediaobject.h"
@@ -59,7 +60,7 @@ VectorGraphicComponent::propDefSet() const
     static auto checkLayout = [](Component& component)
     {
         auto& vg = static_cast<VectorGraphicComponent&>(component);
-        vg.processLayoutChanges(true, false);
+        vg.requestMediaBoundsUpdate();
     };
 
     static auto resetOnLoadOnFailFlag = [](Component& component) {
@@ -120,6 +121,16 @@ VectorGraphicComponent::initialize()
     }
 }
 
+/**
+ * The styles of the graphic elements are evaluated with the state of this component as well, so any state
+ * change may restyle the graphic.
+ */
+bool
+VectorGraphicComponent::isStyleSensitiveTo(unsigned int changedStates) const
+{
+    return changedStates != 0;
+}
+
 void
 VectorGraphicComponent::updateStyle()
 {
@@ -132,7 +143,7 @@ VectorGraphicComponent::updateStyle()
         setDirty(kPropertyGraphic);
 
     // Changing the style may result in a size change or a position change
-    processLayoutChanges(true, false);
+    requestMediaBoundsUpdate();
 }
 
 const EventPropertyMap&
@@ -185,6 +196,31 @@ void
 VectorGraphicComponent::processLayoutChanges(bool useDirtyFlag, bool first)
 {
     CoreComponent::processLayoutChanges(useDirtyFlag, first);
+    updateMediaBounds(useDirtyFlag);
+}
+
+void
+VectorGraphicComponent::processPendingLayoutChanges(bool useDirtyFlag)
+{
+    if (mMediaBoundsPending)
+        updateMediaBounds(useDirtyFlag);
+}
+
+void
+VectorGraphicComponent::requestMediaBoundsUpdate()
+{
+    // Align, scale and style changes within the same frame share a single media bounds computation
+    if (mMediaBoundsPending)
+        return;
+
+    mMediaBoundsPending = true;
+    mContext->layoutManager().requestLayoutChanges(shared_from_corecomponent());
+}
+
+void
+VectorGraphicComponent::updateMediaBounds(bool useDirtyFlag)
+{
+    mMediaBoundsPending = false;
 
     auto graphic = mCalculated.get(kPropertyGraphic);
     if (graphic.isGraphic()) {
@@ -267,6 +303,7 @@ VectorGraphicComponent::processLayoutChanges(bool useDirtyFlag, bool first)
                 break;
         }
 
+        mMediaBoundsUpdateCount++;
         Rect r(x, y, width, height);
         auto mediaBounds = mCalculated.get(kPropertyMediaBounds);
         if (!mediaBounds.isRect() || r != mediaBounds.getRect()) {
@@ -410,19 +447,23 @@ VectorGraphicComponent::onFail(const MediaObjectPtr& mediaObject)
 {
     if (mOnLoadOnFailReported)
         return;
+    mOnLoadOnFailReported = true;
+
     auto component = getComponent();
+    auto& commands = component->getCalculated(kPropertyOnFail);
+    if (commands.empty())
+        return;
+
     auto errorData = std::make_shared<ObjectMap>();
-    errorData->emplace("value",  mediaObject->url());
+    errorData->emplace("value", mediaObject->url());
     errorData->emplace("error", mediaObject->errorDescription());
     errorData->emplace("errorCode", mediaObject->errorCode());
-    auto& commands = component->getCalculated(kPropertyOnFail);
     auto eventContext = component->createEventContext("Fail", errorData);
     component->getContext()->sequencer().executeCommands(
         commands,
         eventContext,
         component->shared_from_corecomponent(),
         true);
-    mOnLoadOnFailReported = true;
 }
 
 void
@@ -430,14 +471,18 @@ VectorGraphicComponent::onLoad()
 {
     if (mOnLoadOnFailReported)
         return;
+    mOnLoadOnFailReported = true;
+
     auto component = getComponent();
     auto& commands = component->getCalculated(kPropertyOnLoad);
+    if (commands.empty())
+        return;
+
     component->getContext()->sequencer().executeCommands(
         commands,
         component->createEventContext("Load"),
         component->shared_from_corecomponent(),
         true);
-    mOnLoadOnFailReported = true;
 }
 
 } // namespace apl
@@ -18,6 +18,7 @@
 #include "apl/component/videocomponent.h"
 #include "apl/component/yogaproperties.h"
 #include "apl/media/mediaplayerfactory.h"
+#include "apl/media/mediaplayerpool.h"
 #include "apl/media/mediautils.h"
 #include "apl/time/sequencer.h"
 
@@ -62,7 +63,13 @@ VideoComponent::VideoComponent(const ContextPtr& context,
     : CoreComponent(context, std::move(properties), path),
       mMediaSequencer("VIDEO"+getUniqueId())
 {
-    mMediaPlayer = mContext->mediaPlayerFactory().createPlayer([this](
+    acquireMediaPlayer();
+}
+
+void
+VideoComponent::acquireMediaPlayer()
+{
+    mMediaPlayer = mContext->mediaPlayerPool().acquire([this](
                                                                    MediaPlayerEventType eventType,
                                                                    const MediaState& mediaState) {
         if (!mMediaPlayer)
@@ -148,20 +155,54 @@ VideoComponent::VideoComponent(const ContextPtr& context,
 }
 
 VideoComponent::~VideoComponent() noexcept
+{
+    releaseMediaPlayer();
+}
+
+void
+VideoComponent::releaseMediaPlayer()
 {
     if (mMediaPlayer) {
-        mMediaPlayer->release();
+        // The pool either keeps the player for another video component or releases it
+        mContext->mediaPlayerPool().release(mMediaPlayer);
         mMediaPlayer = nullptr;
+        mMediaPlayerReleased = true;
     }
 }
 
+void
+VideoComponent::release()
+{
+    releaseMediaPlayer();
+    CoreComponent::release();
+}
+
 bool
 VideoComponent::remove()
 {
-    if (mMediaPlayer)
-        mMediaPlayer->halt();
+    if (!CoreComponent::remove())
+        return false;
+
+    // A detached video can't play, so its player is handed over to newly attached video components
+    releaseMediaPlayer();
+    return true;
+}
+
+void
+VideoComponent::attachedToParent(const CoreComponentPtr& parent)
+{
+    CoreComponent::attachedToParent(parent);
+
+    // Re-attached after a removal: bind a player again and restore its tracks
+    if (!mMediaPlayerReleased)
+        return;
 
-    return CoreComponent::remove();
+    mMediaPlayerReleased = false;
+    acquireMediaPlayer();
+    if (mMediaPlayer) {
+        mMediaPlayer->setAudioTrack(static_cast<AudioTrack>(getCalculated(kPropertyAudioTrack).getInteger()));
+        mMediaPlayer->setTrackList(mediaSourcesToTracks(getCalculated(kPropertySource)));
+    }
 }
 
 const ComponentPropDefSet&
@@ -151,6 +151,45 @@ ConfigurationChange::asEventProperties(const RootConfig& rootConfig, const Metri
     };
 }
 
+rapidjson::Value
+ConfigurationChange::serialize(rapidjson::Document::AllocatorType& allocator) const
+{
+    rapidjson::Value v(rapidjson::kObjectType);
+
+    if ((mFlags & kConfigurationChangeSize) != 0) {
+        v.AddMember("width", mPixelWidth, allocator);
+        v.AddMember("height", mPixelHeight, allocator);
+    }
+
+    if ((mFlags & kConfigurationChangeTheme) != 0)
+        v.AddMember("theme", rapidjson::Value(mTheme.c_str(), allocator).Move(), allocator);
+
+    if ((mFlags & kConfigurationChangeViewportMode) != 0)
+        v.AddMember("mode", static_cast<int>(mViewportMode), allocator);
+
+    if ((mFlags & kConfigurationChangeScreenMode) != 0)
+        v.AddMember("screenMode", static_cast<int>(mScreenMode), allocator);
+
+    if ((mFlags & kConfigurationChangeFontScale) != 0)
+        v.AddMember("fontScale", static_cast<double>(mFontScale), allocator);
+
+    if ((mFlags & kConfigurationChangeScreenReader) != 0)
+        v.AddMember("screenReader", mScreenReaderEnabled, allocator);
+
+    if ((mFlags & kConfigurationChangeDisallowVideo) != 0)
+        v.AddMember("disallowVideo", mDisallowVideo, allocator);
+
+    if ((mFlags & kConfigurationChangeEnvironment) != 0) {
+        rapidjson::Value env(rapidjson::kObjectType);
+        for (const auto& prop : mEnvironment)
+            env.AddMember(rapidjson::Value(prop.first.c_str(), allocator).Move(),
+                          prop.second.serialize(allocator), allocator);
+        v.AddMember("environment", env, allocator);
+    }
+
+    return v;
+}
+
 const std::set<std::string> &
 ConfigurationChange::getSynthesizedPropertyNames() {
     static std::set<std::string> sNames = {
@@ -190,6 +190,9 @@ RootConfig::propDefSet() const
             {RootProperty::kSendEventAdditionalFlags,                    Object::EMPTY_MAP(),                           asAny},
             {RootProperty::kTextMeasurementCacheLimit,                   500,                                           asInteger},
             {RootProperty::kInitialDisplayState,                         DEFAULT_DISPLAY_STATE,                         sDisplayStateMap},
+            {RootProperty::kMediaPlayerPoolSize,                         0,                                             asNonNegativeInteger},
+            {RootProperty::kMaxMediaRequestsInFlight,                    0,                                             asNonNegativeInteger},
+            {RootProperty::kMediaRequestCancelDistance,                  -1,                                            asNumber},
         });
     return sRootProperties;
 }
@@ -18,6 +18,7 @@
 #include "apl/datagrammar/bytecodeevaluator.h"
 #include "apl/datagrammar/boundsymbol.h"
 #include "apl/engine/context.h"
+#include "apl/primitives/functions.h"
 #include "apl/utils/session.h"
 
 namespace apl {
@@ -136,6 +137,126 @@ ByteCode::symbols(SymbolReferenceMap& symbols)
         symbols.emplace(ref);
 }
 
+static bool
+isJumpInstruction(const ByteCodeInstruction& cmd)
+{
+    switch (cmd.type) {
+        case BC_OPCODE_JUMP:
+        case BC_OPCODE_JUMP_IF_FALSE_OR_POP:
+        case BC_OPCODE_JUMP_IF_TRUE_OR_POP:
+        case BC_OPCODE_JUMP_IF_NOT_NULL_OR_POP:
+        case BC_OPCODE_POP_JUMP_IF_FALSE:
+            return true;
+        default:
+            return false;
+    }
+}
+
+static bool
+isLoadInstruction(const ByteCodeInstruction& cmd)
+{
+    return cmd.type == BC_OPCODE_LOAD_DATA || cmd.type == BC_OPCODE_LOAD_IMMEDIATE ||
+           cmd.type == BC_OPCODE_LOAD_CONSTANT;
+}
+
+static long long
+greatestCommonDivisor(long long a, long long b)
+{
+    while (b != 0) {
+        auto t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+apl_duration_t
+ByteCode::clockGranularity(const std::string& symbol) const
+{
+    const auto len = static_cast<int>(mInstructions.size());
+
+    // The patterns below are only valid over straight-line code, so we note where every jump lands
+    std::vector<bool> jumpTarget(len + 1, false);
+    for (int pc = 0; pc < len; pc++) {
+        const auto& cmd = mInstructions.at(pc);
+        if (isJumpInstruction(cmd)) {
+            auto target = pc + cmd.value + 1;
+            if (target >= 0 && target <= len)
+                jumpTarget[target] = true;
+        }
+    }
+
+    auto straightLine = [&](int start, int end) {
+        for (int pc = start; pc <= end; pc++)
+            if (pc < 0 || pc >= len || jumpTarget[pc])
+                return false;
+        return true;
+    };
+
+    auto loadedValue = [&](const ByteCodeInstruction& cmd) -> Object {
+        switch (cmd.type) {
+            case BC_OPCODE_LOAD_DATA: return mData.at(cmd.value);
+            case BC_OPCODE_LOAD_IMMEDIATE: return cmd.value;
+            case BC_OPCODE_LOAD_CONSTANT: return getConstant(static_cast<ByteCodeConstant>(cmd.value));
+            default: return Object::NULL_OBJECT();
+        }
+    };
+
+    // Granularity of a clock symbol loaded at "pc".  Recognized patterns are:
+    //    LOAD F, LOAD A1...LOAD An, LOAD_BOUND_SYMBOL clock, CALL_FUNCTION(n+1)
+    //    LOAD F, LOAD_BOUND_SYMBOL clock, LOAD N, DIVIDE, CALL_FUNCTION(1)
+    auto granularityAt = [&](int pc) -> apl_duration_t {
+        if (pc + 1 < len && mInstructions.at(pc + 1).type == BC_OPCODE_CALL_FUNCTION) {
+            auto argCount = mInstructions.at(pc + 1).value;
+            auto start = pc - argCount;
+            if (argCount < 1 || start < 0 || !straightLine(start + 1, pc + 1) || mInstructions.at(start).type != BC_OPCODE_LOAD_DATA)
+                return 1;
+
+            ObjectArray args;
+            for (int i = start + 1; i < pc; i++) {
+                if (!isLoadInstruction(mInstructions.at(i)))
+                    return 1;
+                args.emplace_back(loadedValue(mInstructions.at(i)));
+            }
+
+            auto result = apl::clockGranularity(mData.at(mInstructions.at(start).value), args, 1);
+            return result > 0 ? result : 1;
+        }
+
+        if (pc > 0 && pc + 3 < len && isLoadInstruction(mInstructions.at(pc + 1)) &&
+            mInstructions.at(pc + 2).type == BC_OPCODE_BINARY_DIVIDE &&
+            mInstructions.at(pc + 3).type == BC_OPCODE_CALL_FUNCTION && mInstructions.at(pc + 3).value == 1 &&
+            straightLine(pc, pc + 3) && mInstructions.at(pc - 1).type == BC_OPCODE_LOAD_DATA) {
+            auto divisor = loadedValue(mInstructions.at(pc + 1));
+            if (divisor.isNumber()) {
+                auto result = apl::clockGranularity(mData.at(mInstructions.at(pc - 1).value), {}, divisor.getDouble());
+                return result > 0 ? result : 1;
+            }
+        }
+
+        return 1;
+    };
+
+    long long result = 0;
+    for (int pc = 0; pc < len; pc++) {
+        const auto& cmd = mInstructions.at(pc);
+        if (cmd.type != BC_OPCODE_LOAD_BOUND_SYMBOL)
+            continue;
+
+        const auto& object = mData.at(cmd.value);
+        if (!object.isBoundSymbol() || object.getBoundSymbol()->getName() != symbol)
+            continue;
+
+        // Two different quantizations of the same clock combine to their common divisor
+        auto granularity = static_cast<long long>(granularityAt(pc));
+        result = result == 0 ? granularity : greatestCommonDivisor(result, granularity);
+        if (result <= 1)
+            return 1;
+    }
+
+    return static_cast<apl_duration_t>(result);
+}
+
 ContextPtr
 ByteCode::getContext() const
 {
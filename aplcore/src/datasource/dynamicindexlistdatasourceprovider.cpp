@@ -37,6 +37,20 @@ const std::map<std::string, DynamicIndexListUpdateType> sDatasourceUpdateType =
     {"DeleteMultipleItems", kTypeDeleteMultiple},
 };
 
+namespace {
+
+/**
+ * Parsed update operation.
+ */
+struct DynamicIndexListOperation {
+    DynamicIndexListUpdateType type;
+    int index;
+    Object items;
+    int count;
+};
+
+} // namespace
+
 DynamicIndexListDataSourceConnection::DynamicIndexListDataSourceConnection(
         DILProviderWPtr provider,
         const DynamicIndexListConfiguration& configuration,
@@ -187,6 +201,69 @@ DynamicIndexListDataSourceConnection::processUpdate(DynamicIndexListUpdateType t
     return result;
 }
 
+bool
+DynamicIndexListDataSourceConnection::canInsert(int index) const {
+    auto liveArray = mLiveArray.lock();
+    if (!liveArray || mContext.expired() || index < mMinimumInclusiveIndex)
+        return false;
+
+    size_t idx = index - mMinimumInclusiveIndex;
+    return idx >= mOffset && idx <= mOffset + liveArray->size();
+}
+
+bool
+DynamicIndexListDataSourceConnection::canRemove(int index, size_t count) const {
+    auto liveArray = mLiveArray.lock();
+    if (!liveArray || mContext.expired() || index < mMinimumInclusiveIndex)
+        return false;
+
+    size_t idx = index - mMinimumInclusiveIndex;
+    return idx >= mOffset && idx + count <= mOffset + liveArray->size();
+}
+
+bool
+DynamicIndexListDataSourceConnection::processInsertRun(int index, const ObjectArray& data) {
+    auto context = mContext.lock();
+    if (!context)
+        return false;
+
+    ObjectArray items;
+    items.reserve(data.size());
+    for (const auto& item : data)
+        items.emplace_back(evaluateRecursive(*context, item));
+
+    if (!insert(index - mMinimumInclusiveIndex, items)) {
+        constructAndReportError(ERROR_REASON_LIST_INDEX_OUT_OF_RANGE, index, "Requested index out of bounds.");
+        return false;
+    }
+
+    // Same as incrementing once per item, stopping at INT_MAX.
+    if (mMaximumExclusiveIndex < INT_MAX)
+        mMaximumExclusiveIndex = std::min<double>(mMaximumExclusiveIndex + items.size(), INT_MAX);
+    return true;
+}
+
+bool
+DynamicIndexListDataSourceConnection::processRemoveRun(int index, size_t count) {
+    if (!remove(index - mMinimumInclusiveIndex, count)) {
+        constructAndReportError(ERROR_REASON_LIST_INDEX_OUT_OF_RANGE, index, "Requested index out of bounds.");
+        return false;
+    }
+
+    if (mMaximumExclusiveIndex < INT_MAX)
+        mMaximumExclusiveIndex -= count;
+    return true;
+}
+
+void
+DynamicIndexListDataSourceConnection::skipInsertRemove() {
+    // Bounds are adjusted exactly as an applied insert and removal would, items are left untouched.
+    if (mMaximumExclusiveIndex < INT_MAX)
+        mMaximumExclusiveIndex++;
+    if (mMaximumExclusiveIndex < INT_MAX)
+        mMaximumExclusiveIndex--;
+}
+
 bool
 DynamicIndexListDataSourceConnection::updateBounds(
         const Object& minimumInclusiveIndexObj,
@@ -325,6 +402,76 @@ DynamicIndexListDataSourceProvider::processLazyLoadInternal(
     return connection->processLazyLoad(startIndex, items, correlationToken);
 }
 
+/**
+ * Apply operations by their net effect. Runs of inserts at consecutive indexes and removals at the same index are
+ * applied as a single change, an insert immediately removed again is dropped and only the last of repeated replaces
+ * of the same index is applied. Anything that would not succeed as a whole falls back to the per-operation path, so
+ * resulting data, bounds and reported errors are the same as processing every operation on its own.
+ *
+ * Only adjacent operations are combined. Operations separated by another one, like an insert and a delete of the
+ * same index with a replace of a different index between them, are applied one by one.
+ */
+static bool
+applyOperations(const DILConnectionPtr& connection, const std::vector<DynamicIndexListOperation>& operations) {
+    size_t i = 0;
+    while (i < operations.size()) {
+        const auto& operation = operations.at(i);
+        size_t end = i + 1;
+
+        if (operation.type == kTypeInsert) {
+            if (end < operations.size()
+             && operations.at(end).type == kTypeDelete
+             && operations.at(end).index == operation.index
+             && connection->canInsert(operation.index)) {
+                connection->skipInsertRemove();
+                i = end + 1;
+                continue;
+            }
+
+            while (end < operations.size()
+                && operations.at(end).type == kTypeInsert
+                && operations.at(end).index == operation.index + static_cast<int>(end - i))
+                end++;
+
+            if (end - i > 1 && connection->canInsert(operation.index)) {
+                ObjectArray items;
+                items.reserve(end - i);
+                for (auto k = i; k < end; k++)
+                    items.emplace_back(operations.at(k).items);
+                if (!connection->processInsertRun(operation.index, items))
+                    return false;
+                i = end;
+                continue;
+            }
+        } else if (operation.type == kTypeDelete) {
+            while (end < operations.size()
+                && operations.at(end).type == kTypeDelete
+                && operations.at(end).index == operation.index)
+                end++;
+
+            if (end - i > 1 && connection->canRemove(operation.index, end - i)) {
+                if (!connection->processRemoveRun(operation.index, end - i))
+                    return false;
+                i = end;
+                continue;
+            }
+        } else if (operation.type == kTypeReplace) {
+            // Replace outcome depends only on the index, so earlier replaces of the same index are never visible.
+            while (i + 1 < operations.size()
+                && operations.at(i + 1).type == kTypeReplace
+                && operations.at(i + 1).index == operation.index)
+                i++;
+        }
+
+        const auto& current = operations.at(i);
+        if (!connection->processUpdate(current.type, current.index, current.items, current.count))
+            return false;
+        i++;
+    }
+
+    return true;
+}
+
 bool
 DynamicIndexListDataSourceProvider::processUpdateInternal(
         const DILConnectionPtr& connection, const Object& responseMap) {
@@ -336,34 +483,35 @@ DynamicIndexListDataSourceProvider::processUpdateInternal(
     }
 
     ObjectArray operations = responseMap.get(OPERATIONS).getArray();
-    bool result = true;
+    std::vector<DynamicIndexListOperation> parsed;
+    parsed.reserve(operations.size());
+    std::string malformed;
 
     for (const auto& operation : operations) {
         if (!operation.has(UPDATE_TYPE) || !operation.get(UPDATE_TYPE).isString() ||
             !operation.has(UPDATE_INDEX) || !operation.get(UPDATE_INDEX).isNumber()) {
-            constructAndReportError(ERROR_REASON_INVALID_OPERATION, connection, Object::NULL_OBJECT(),
-                    "Operation malformed.");
-            result = false;
+            malformed = "Operation malformed.";
             break;
         }
 
         auto typeName = operation.get(UPDATE_TYPE).asString();
         if (!sDatasourceUpdateType.count(typeName)) {
-            constructAndReportError(ERROR_REASON_INVALID_OPERATION, connection, Object::NULL_OBJECT(),
-                    "Wrong update type.");
-            result = false;
+            malformed = "Wrong update type.";
             break;
         }
 
-        auto type = sDatasourceUpdateType.at(typeName);
-        auto index = operation.get(UPDATE_INDEX).asInt();
         auto item = operation.get(UPDATE_ITEM);
-        auto items = item.isNull() ? operation.get(UPDATE_ITEMS) : item;
-        auto count = operation.opt(COUNT, item.size()).asInt();
-        if (!connection->processUpdate(type, index, items, count)) {
-            result = false;
-            break;
-        }
+        parsed.push_back({sDatasourceUpdateType.at(typeName),
+                          operation.get(UPDATE_INDEX).asInt(),
+                          item.isNull() ? operation.get(UPDATE_ITEMS) : item,
+                          operation.opt(COUNT, item.size()).asInt()});
+    }
+
+    // Operations preceding a malformed one are still applied, as if it was processed in order.
+    bool result = applyOperations(connection, parsed);
+    if (result && !malformed.empty()) {
+        constructAndReportError(ERROR_REASON_INVALID_OPERATION, connection, Object::NULL_OBJECT(), malformed);
+        result = false;
     }
 
     if (!result) {
@@ -13,6 +13,9 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <queue>
 
 #include "apl/buildTimeConstants.h"
@@ -380,6 +383,11 @@ Context::mediaPlayerFactory() const {
     return mCore->mediaPlayerFactory();
 }
 
+MediaPlayerPool&
+Context::mediaPlayerPool() const {
+    return mCore->mediaPlayerPool();
+}
+
 const SessionPtr&
 Context::session() const {
     return mCore->session();
@@ -482,4 +490,197 @@ bool Context::systemUpdateAndRecalculate(const std::string& key, const Object& v
     return true;
 }
 
+bool
+Context::addDownstream(const std::string& key, const std::shared_ptr<Dependant>& dependant)
+{
+    if (!RecalculateSource::addDownstream(key, dependant))
+        return false;
+
+    auto name = key.substr(0, key.find('/'));
+    auto it = mClocks.find(name);
+    if (it != mClocks.end())
+        scheduleClockDependant(it->second, dependant, dependant->clockGranularity(it->first));
+
+    auto object = mMap.find(name);
+    if (object != mMap.end()) {
+        const auto& value = object->second.value();
+        if ((value.isMap() || value.isArray()) && value.getLiveDataObject()) {
+            auto start = std::min(name.size() + 1, key.size());
+            mMemberDownstream[name].emplace(key.substr(start, key.find('/', start) - start), dependant);
+        }
+    }
+
+    return true;
+}
+
+void
+Context::removeDownstream(const std::shared_ptr<Dependant>& dependant)
+{
+    RecalculateSource::removeDownstream(dependant);
+
+    for (auto& object : mMemberDownstream) {
+        auto& members = object.second;
+        for (auto it = members.begin(); it != members.end();) {
+            if (it->second.expired() || it->second.lock() == dependant)
+                it = members.erase(it);
+            else
+                it++;
+        }
+    }
+
+    for (auto& clock : mClocks) {
+        auto& everyChange = clock.second.everyChange;
+        everyChange.erase(std::remove_if(everyChange.begin(), everyChange.end(),
+                                         [&](const std::weak_ptr<Dependant>& m) {
+                                             return m.expired() || m.lock() == dependant;
+                                         }),
+                          everyChange.end());
+
+        auto& boundaries = clock.second.boundaries;
+        for (auto it = boundaries.begin(); it != boundaries.end();) {
+            if (it->second.dependant.expired() || it->second.dependant.lock() == dependant)
+                it = boundaries.erase(it);
+            else
+                it++;
+        }
+    }
+}
+
+void
+Context::recalculateDownstreamMembers(const std::string& key,
+                                      const std::function<bool(const std::string&)>& changed,
+                                      bool useDirtyFlag)
+{
+    auto it = mMemberDownstream.find(key);
+    if (it == mMemberDownstream.end()) {
+        recalculateDownstream(key, useDirtyFlag);
+        return;
+    }
+
+    // Collect first, a dependant may refer to several changed members and recalculation may add dependants
+    std::vector<std::shared_ptr<Dependant>> dependants;
+    std::set<Dependant *> collected;
+    auto& members = it->second;
+    auto member = members.begin();
+    while (member != members.end()) {
+        auto range = members.equal_range(member->first);
+        auto hasChanged = member->first.empty() || changed(member->first);
+        for (member = range.first; member != range.second;) {
+            auto ptr = member->second.lock();
+            if (!ptr) {
+                member = members.erase(member);
+                continue;
+            }
+
+            if (hasChanged && collected.emplace(ptr.get()).second)
+                dependants.emplace_back(std::move(ptr));
+            member++;
+        }
+    }
+
+    for (const auto& dependant : dependants)
+        dependant->recalculate(useDirtyFlag);
+}
+
+void
+Context::scheduleClockDependant(ClockSchedule& schedule, const std::shared_ptr<Dependant>& dependant,
+                                apl_duration_t granularity)
+{
+    if (granularity <= 1) {
+        schedule.everyChange.emplace_back(dependant);
+        return;
+    }
+
+    auto boundary = (std::floor(schedule.time / granularity) + 1) * granularity;
+    schedule.boundaries.emplace(boundary, ClockDependant{granularity, dependant});
+}
+
+Context::ClockSchedule&
+Context::clockSchedule(const std::string& key, apl_time_t time)
+{
+    auto it = mClocks.find(key);
+    if (it != mClocks.end())
+        return it->second;
+
+    // The granularity of each dependant is calculated once, when it is scheduled
+    auto& schedule = mClocks[key];
+    schedule.time = time;
+    visitDownstream(key, [&](Dependant& dependant) {
+        scheduleClockDependant(schedule, dependant.shared_from_this(), dependant.clockGranularity(key));
+    });
+    return schedule;
+}
+
+bool Context::systemUpdateClockAndRecalculate(const std::string& key, apl_time_t value, bool useDirtyFlag) {
+    auto it = mMap.find(key);
+    if (it == mMap.end())
+        return false;
+
+    if (!it->second.isMutable())
+        return true;
+
+    removeUpstream(key);  // Break any dependency chain
+    auto& schedule = clockSchedule(key, it->second.value().asNumber());
+    if (!it->second.set(value))
+        return true;
+
+    auto oldValue = schedule.time;
+    schedule.time = value;
+
+    auto& everyChange = schedule.everyChange;
+    everyChange.erase(std::remove_if(everyChange.begin(), everyChange.end(),
+                                     [](const std::weak_ptr<Dependant>& m) { return m.expired(); }),
+                      everyChange.end());
+
+    // Collect the due dependants and reschedule them before recalculating, as recalculation may add or
+    // remove dependants.
+    std::vector<std::weak_ptr<Dependant>> due(schedule.everyChange.begin(), schedule.everyChange.end());
+    std::vector<ClockDependant> crossed;
+    if (value < oldValue) {
+        // The clock went backwards, so every quantized dependant is on a new boundary
+        for (auto& m : schedule.boundaries)
+            crossed.emplace_back(std::move(m.second));
+        schedule.boundaries.clear();
+    } else {
+        auto end = schedule.boundaries.upper_bound(value);
+        for (auto m = schedule.boundaries.begin(); m != end; m++)
+            crossed.emplace_back(std::move(m->second));
+        schedule.boundaries.erase(schedule.boundaries.begin(), end);
+    }
+
+    for (const auto& m : crossed) {
+        auto dependant = m.dependant.lock();
+        if (dependant) {
+            scheduleClockDependant(schedule, dependant, m.granularity);
+            due.emplace_back(dependant);
+        }
+    }
+
+    for (const auto& m : due) {
+        auto dependant = m.lock();
+        if (dependant)
+            dependant->recalculate(useDirtyFlag);
+    }
+
+    return true;
+}
+
+apl_duration_t
+Context::clockBoundaryDelay(const std::string& key)
+{
+    auto it = mMap.find(key);
+    if (it == mMap.end())
+        return std::numeric_limits<apl_duration_t>::max();
+
+    auto value = it->second.value().asNumber();
+    auto& schedule = clockSchedule(key, value);
+    if (!schedule.everyChange.empty())
+        return std::floor(value) + 1 - value;
+
+    if (schedule.boundaries.empty())
+        return std::numeric_limits<apl_duration_t>::max();
+
+    return schedule.boundaries.begin()->first - value;
+}
+
 }  // namespace apl
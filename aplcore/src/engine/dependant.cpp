@@ -14,6 +14,7 @@
  */
 
 #include "apl/engine/dependant.h"
+#include "apl/datagrammar/bytecode.h"
 #include "apl/engine/context.h"
 #include "apl/primitives/symbolreferencemap.h"
 
@@ -30,4 +31,14 @@ Dependant::removeFromSource()
     mEquation = Object::NULL_OBJECT();
 };
 
+apl_duration_t
+Dependant::clockGranularity(const std::string& symbol) const
+{
+    if (!mEquation.isByteCode())
+        return 1;
+
+    auto granularity = mEquation.getByteCode()->clockGranularity(symbol);
+    return granularity > 1 ? granularity : 1;
+}
+
 }  // namespace apl
\ No newline at end of file
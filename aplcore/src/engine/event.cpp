@@ -27,6 +27,7 @@ Bimap<int, std::string> sEventTypeBimap = {
     {kEventTypeExtension,              "extension"},
     {kEventTypeFocus,                  "focus"},
     {kEventTypeFinish,                 "finish"},
+    {kEventTypeMediaCancel,            "mediaCancel"},
     {kEventTypeMediaRequest,           "mediaRequest"},
     {kEventTypeOpenURL,                "openURL"},
     {kEventTypePlayMedia,              "playMedia"},
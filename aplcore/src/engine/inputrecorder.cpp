@@ -0,0 +1,183 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "rapidjson/stringbuffer.h"
+#include "rapidjson/writer.h"
+
+#include "apl/engine/inputrecorder.h"
+#include "apl/content/configurationchange.h"
+#include "apl/touch/pointerevent.h"
+
+namespace apl {
+
+Bimap<InputRecordType, std::string> sInputRecordTypeBimap = {
+    {kInputRecordUpdateTime,          "updateTime"},
+    {kInputRecordPointerEvent,        "pointer"},
+    {kInputRecordKeyboard,            "keyboard"},
+    {kInputRecordConfigurationChange, "configurationChange"},
+    {kInputRecordDisplayState,        "displayState"},
+    {kInputRecordMediaLoaded,         "mediaLoaded"},
+    {kInputRecordMediaLoadFailed,     "mediaLoadFailed"},
+    {kInputRecordExecuteCommands,     "executeCommands"},
+    {kInputRecordExtensionEvent,      "extensionEvent"},
+    {kInputRecordCancelExecution,     "cancelExecution"},
+    {kInputRecordReinflate,           "reinflate"},
+};
+
+rapidjson::Document
+InputRecorder::start(apl_time_t time, InputRecordType type)
+{
+    rapidjson::Document record(rapidjson::kObjectType);
+    auto& allocator = record.GetAllocator();
+    record.AddMember("time", time, allocator);
+    record.AddMember("type", rapidjson::StringRef(sInputRecordTypeBimap.at(type).c_str()), allocator);
+    return record;
+}
+
+void
+InputRecorder::append(const rapidjson::Document& record)
+{
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    record.Accept(writer);
+    mRecords.emplace_back(buffer.GetString(), buffer.GetSize());
+}
+
+void
+InputRecorder::recordUpdateTime(apl_time_t elapsedTime)
+{
+    append(start(elapsedTime, kInputRecordUpdateTime));
+}
+
+void
+InputRecorder::recordUpdateTime(apl_time_t elapsedTime, apl_time_t utcTime)
+{
+    auto record = start(elapsedTime, kInputRecordUpdateTime);
+    record.AddMember("utc", utcTime, record.GetAllocator());
+    append(record);
+}
+
+void
+InputRecorder::recordPointerEvent(apl_time_t time, const PointerEvent& pointerEvent)
+{
+    auto record = start(time, kInputRecordPointerEvent);
+    auto& allocator = record.GetAllocator();
+    record.AddMember("event", static_cast<int>(pointerEvent.pointerEventType), allocator);
+    record.AddMember("x", static_cast<double>(pointerEvent.pointerEventPosition.getX()), allocator);
+    record.AddMember("y", static_cast<double>(pointerEvent.pointerEventPosition.getY()), allocator);
+    record.AddMember("id", pointerEvent.pointerId, allocator);
+    record.AddMember("pointer", static_cast<int>(pointerEvent.pointerType), allocator);
+    append(record);
+}
+
+void
+InputRecorder::recordKeyboard(apl_time_t time, KeyHandlerType type, const Keyboard& keyboard)
+{
+    auto record = start(time, kInputRecordKeyboard);
+    auto& allocator = record.GetAllocator();
+    record.AddMember("handler", static_cast<int>(type), allocator);
+    record.AddMember("keyboard", keyboard.serialize(allocator), allocator);
+    append(record);
+}
+
+void
+InputRecorder::recordConfigurationChange(apl_time_t time, const ConfigurationChange& change)
+{
+    auto record = start(time, kInputRecordConfigurationChange);
+    auto& allocator = record.GetAllocator();
+    record.AddMember("change", change.serialize(allocator), allocator);
+    append(record);
+}
+
+void
+InputRecorder::recordDisplayState(apl_time_t time, DisplayState displayState)
+{
+    auto record = start(time, kInputRecordDisplayState);
+    record.AddMember("state", static_cast<int>(displayState), record.GetAllocator());
+    append(record);
+}
+
+void
+InputRecorder::recordMediaLoaded(apl_time_t time, const std::string& source)
+{
+    auto record = start(time, kInputRecordMediaLoaded);
+    auto& allocator = record.GetAllocator();
+    record.AddMember("source", rapidjson::Value(source.c_str(), allocator), allocator);
+    append(record);
+}
+
+void
+InputRecorder::recordMediaLoadFailed(apl_time_t time, const std::string& source, int errorCode,
+                                     const std::string& error)
+{
+    auto record = start(time, kInputRecordMediaLoadFailed);
+    auto& allocator = record.GetAllocator();
+    record.AddMember("source", rapidjson::Value(source.c_str(), allocator), allocator);
+    record.AddMember("errorCode", errorCode, allocator);
+    record.AddMember("error", rapidjson::Value(error.c_str(), allocator), allocator);
+    append(record);
+}
+
+void
+InputRecorder::recordExecuteCommands(apl_time_t time, const Object& commands, bool fastMode)
+{
+    auto record = start(time, kInputRecordExecuteCommands);
+    auto& allocator = record.GetAllocator();
+    record.AddMember("commands", commands.serialize(allocator), allocator);
+    record.AddMember("fastMode", fastMode, allocator);
+    append(record);
+}
+
+void
+InputRecorder::recordExtensionEvent(apl_time_t time, const std::string& uri, const std::string& name,
+                                    const ObjectMap& data, bool fastMode, const std::string& resourceId)
+{
+    auto record = start(time, kInputRecordExtensionEvent);
+    auto& allocator = record.GetAllocator();
+    record.AddMember("uri", rapidjson::Value(uri.c_str(), allocator), allocator);
+    record.AddMember("name", rapidjson::Value(name.c_str(), allocator), allocator);
+    rapidjson::Value map(rapidjson::kObjectType);
+    for (const auto& m : data)
+        map.AddMember(rapidjson::Value(m.first.c_str(), allocator), m.second.serialize(allocator), allocator);
+    record.AddMember("data", map, allocator);
+    record.AddMember("fastMode", fastMode, allocator);
+    record.AddMember("resourceId", rapidjson::Value(resourceId.c_str(), allocator), allocator);
+    append(record);
+}
+
+void
+InputRecorder::recordCancelExecution(apl_time_t time)
+{
+    append(start(time, kInputRecordCancelExecution));
+}
+
+void
+InputRecorder::recordReinflate(apl_time_t time)
+{
+    append(start(time, kInputRecordReinflate));
+}
+
+std::string
+InputRecorder::serialize() const
+{
+    std::string result;
+    for (const auto& record : mRecords) {
+        result += record;
+        result += '\n';
+    }
+    return result;
+}
+
+} // namespace apl
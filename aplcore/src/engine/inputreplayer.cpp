@@ -0,0 +1,234 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <cmath>
+#include <sstream>
+
+#include "apl/engine/inputreplayer.h"
+#include "apl/component/component.h"
+#include "apl/component/textmeasurement.h"
+#include "apl/content/configurationchange.h"
+#include "apl/engine/inputrecorder.h"
+#include "apl/engine/rootcontext.h"
+#include "apl/primitives/keyboard.h"
+#include "apl/touch/pointerevent.h"
+#include "apl/utils/log.h"
+
+namespace apl {
+
+/**
+ * Lays out every character as a 10x10 cell, wrapping at the available width.  The result only
+ * depends on the length of the text, so a replayed session lays out identically on every machine.
+ */
+class ReplayTextMeasurement : public TextMeasurement {
+public:
+    LayoutSize measure(Component *component, float width, MeasureMode widthMode,
+                       float height, MeasureMode heightMode) override {
+        auto len = component->getCalculated(kPropertyText).asString().size();
+        float w = len * CELL;
+        float h = len ? CELL : 0;
+        auto workingWidth = CELL * std::floor(width / CELL);
+
+        if (widthMode != MeasureMode::Undefined && w > workingWidth) {
+            h = workingWidth > 0 ? CELL * std::ceil(w / workingWidth) : 0;
+            w = workingWidth;
+        }
+        if (widthMode == MeasureMode::Exactly)
+            w = width;
+
+        if (heightMode == MeasureMode::Exactly || (heightMode == MeasureMode::AtMost && h > height))
+            h = height;
+
+        return { w, h };
+    }
+
+    float baseline(Component *component, float width, float height) override {
+        return CELL * 0.8f;
+    }
+
+private:
+    static constexpr float CELL = 10;
+};
+
+constexpr float ReplayTextMeasurement::CELL;
+
+/**
+ * Convert a JSON value from the trace into an object that owns its own copy of the data.  The
+ * root context may keep the object long after the replayer has been released.
+ */
+static Object
+ownedObject(const rapidjson::Value& value)
+{
+    rapidjson::Document doc;
+    doc.CopyFrom(value, doc.GetAllocator());
+    return Object(std::move(doc));
+}
+
+static std::string
+getString(const rapidjson::Value& record, const char *name)
+{
+    auto it = record.FindMember(name);
+    return it != record.MemberEnd() && it->value.IsString() ? it->value.GetString() : "";
+}
+
+static ConfigurationChange
+configurationChangeFromJson(const rapidjson::Value& json)
+{
+    ConfigurationChange change;
+    if (!json.IsObject())
+        return change;
+
+    if (json.HasMember("width") && json.HasMember("height"))
+        change.size(json["width"].GetInt(), json["height"].GetInt());
+    if (json.HasMember("theme"))
+        change.theme(json["theme"].GetString());
+    if (json.HasMember("mode"))
+        change.mode(static_cast<ViewportMode>(json["mode"].GetInt()));
+    if (json.HasMember("fontScale"))
+        change.fontScale(static_cast<float>(json["fontScale"].GetDouble()));
+    if (json.HasMember("disallowVideo"))
+        change.disallowVideo(json["disallowVideo"].GetBool());
+    if (json.HasMember("screenMode"))
+        change.screenMode(static_cast<RootConfig::ScreenMode>(json["screenMode"].GetInt()));
+    if (json.HasMember("screenReader"))
+        change.screenReader(json["screenReader"].GetBool());
+    if (json.HasMember("environment") && json["environment"].IsObject()) {
+        for (const auto& m : json["environment"].GetObject())
+            change.environmentValue(m.name.GetString(), ownedObject(m.value));
+    }
+
+    return change;
+}
+
+InputReplayerPtr
+InputReplayer::create(const std::string& trace)
+{
+    std::vector<rapidjson::Document> records;
+    std::istringstream stream(trace);
+    std::string line;
+    int lineNumber = 0;
+
+    while (std::getline(stream, line)) {
+        lineNumber++;
+        if (line.empty())
+            continue;
+
+        rapidjson::Document doc;
+        doc.Parse(line.c_str());
+        if (doc.HasParseError() || !doc.IsObject() || !doc.HasMember("time") || !doc.HasMember("type") ||
+            !doc["type"].IsString() || !sInputRecordTypeBimap.has(doc["type"].GetString())) {
+            LOG(LogLevel::kError) << "Unable to parse input trace at line " << lineNumber;
+            return nullptr;
+        }
+
+        records.emplace_back(std::move(doc));
+    }
+
+    return std::make_shared<InputReplayer>(std::move(records));
+}
+
+TextMeasurementPtr
+InputReplayer::textMeasurement()
+{
+    return std::make_shared<ReplayTextMeasurement>();
+}
+
+bool
+InputReplayer::step(const RootContextPtr& root)
+{
+    if (done() || !root)
+        return false;
+
+    const auto& record = mRecords.at(mPosition++);
+    auto time = record["time"].GetDouble();
+
+    switch (sInputRecordTypeBimap.get(record["type"].GetString(), kInputRecordUpdateTime)) {
+        case kInputRecordUpdateTime:
+            if (record.HasMember("utc"))
+                root->updateTime(time, record["utc"].GetDouble());
+            else
+                root->updateTime(time);
+            break;
+
+        case kInputRecordPointerEvent:
+            root->handlePointerEvent(PointerEvent(
+                static_cast<PointerEventType>(record["event"].GetInt()),
+                Point(static_cast<float>(record["x"].GetDouble()), static_cast<float>(record["y"].GetDouble())),
+                record["id"].GetUint(),
+                static_cast<PointerType>(record["pointer"].GetInt())));
+            break;
+
+        case kInputRecordKeyboard: {
+            const auto& json = record["keyboard"];
+            auto keyboard = Keyboard(getString(json, "code"), getString(json, "key"))
+                                .repeat(json["repeat"].GetBool())
+                                .alt(json["altKey"].GetBool())
+                                .ctrl(json["ctrlKey"].GetBool())
+                                .meta(json["metaKey"].GetBool())
+                                .shift(json["shiftKey"].GetBool());
+            root->handleKeyboard(static_cast<KeyHandlerType>(record["handler"].GetInt()), keyboard);
+        }
+            break;
+
+        case kInputRecordConfigurationChange:
+            root->configurationChange(configurationChangeFromJson(record["change"]));
+            break;
+
+        case kInputRecordDisplayState:
+            root->updateDisplayState(static_cast<DisplayState>(record["state"].GetInt()));
+            break;
+
+        case kInputRecordMediaLoaded:
+            root->mediaLoaded(getString(record, "source"));
+            break;
+
+        case kInputRecordMediaLoadFailed:
+            root->mediaLoadFailed(getString(record, "source"), record["errorCode"].GetInt(),
+                                  getString(record, "error"));
+            break;
+
+        case kInputRecordExecuteCommands:
+            root->executeCommands(ownedObject(record["commands"]), record["fastMode"].GetBool());
+            break;
+
+        case kInputRecordExtensionEvent: {
+            ObjectMap data;
+            for (const auto& m : record["data"].GetObject())
+                data.emplace(m.name.GetString(), ownedObject(m.value));
+            root->invokeExtensionEventHandler(getString(record, "uri"), getString(record, "name"), data,
+                                              record["fastMode"].GetBool(), getString(record, "resourceId"));
+        }
+            break;
+
+        case kInputRecordCancelExecution:
+            root->cancelExecution();
+            break;
+
+        case kInputRecordReinflate:
+            root->reinflate();
+            break;
+    }
+
+    return true;
+}
+
+void
+InputReplayer::replay(const RootContextPtr& root)
+{
+    while (step(root))
+        ;
+}
+
+} // namespace apl
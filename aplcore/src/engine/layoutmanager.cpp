@@ -46,6 +46,7 @@ LayoutManager::terminate()
 {
     mTerminated = true;
     mPendingLayout.clear();
+    mPendingLayoutChanges.clear();
 }
 
 bool
@@ -54,7 +55,7 @@ LayoutManager::needsLayout() const
     if (mTerminated)
         return false;
 
-    return !mPendingLayout.empty();
+    return !mPendingLayout.empty() || !mPendingLayoutChanges.empty();
 }
 
 void
@@ -119,17 +120,26 @@ LayoutManager::layout(bool useDirtyFlag, bool first)
 
     mInLayout = true;
     while (needsLayout()) {
-        LOG_IF(DEBUG_LAYOUT_MANAGER) << "Laying out " << mPendingLayout.size() << " component(s)";
+        while (!mPendingLayout.empty() && !mTerminated) {
+            LOG_IF(DEBUG_LAYOUT_MANAGER) << "Laying out " << mPendingLayout.size() << " component(s)";
 
-        // Copy the pending components into a vector and sort them from top to bottom
-        std::vector<CoreComponentPtr> dirty(mPendingLayout.begin(), mPendingLayout.end());
-        std::sort(dirty.begin(), dirty.end(), compareComponents);
-        mPendingLayout.clear();
+            // Copy the pending components into a vector and sort them from top to bottom
+            std::vector<CoreComponentPtr> dirty(mPendingLayout.begin(), mPendingLayout.end());
+            std::sort(dirty.begin(), dirty.end(), compareComponents);
+            mPendingLayout.clear();
 
-        for (const auto& m : dirty) {
-            layoutComponent(m, useDirtyFlag, first);
-            laidOut.emplace(m);
+            for (const auto& m : dirty) {
+                layoutComponent(m, useDirtyFlag, first);
+                laidOut.emplace(m);
+            }
         }
+
+        // Changes that don't move Yoga nodes (such as a new align or scale) are only resolved here.  A component
+        // whose layout also changed has already resolved them in processLayoutChanges and skips the call.
+        auto pending = std::move(mPendingLayoutChanges);
+        mPendingLayoutChanges.clear();
+        for (const auto& m : pending)
+            m->processPendingLayoutChanges(useDirtyFlag);
     }
     mInLayout = false;
 
@@ -235,6 +245,7 @@ void
 LayoutManager::remove(const CoreComponentPtr& component)
 {
     mPendingLayout.erase(component);
+    mPendingLayoutChanges.erase(component);
 }
 
 
@@ -295,6 +306,17 @@ LayoutManager::ensure(const CoreComponentPtr& component)
     return result;
 }
 
+void
+LayoutManager::requestLayoutChanges(const CoreComponentPtr& component)
+{
+    LOG_IF(DEBUG_LAYOUT_MANAGER) << component->toDebugSimpleString();
+
+    if (mTerminated)
+        return;
+
+    mPendingLayoutChanges.emplace(component);
+}
+
 void
 LayoutManager::addPostProcess(const CoreComponentPtr& component, PropertyKey key, const Object& value)
 {
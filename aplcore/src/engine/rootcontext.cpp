@@ -14,6 +14,7 @@
  */
 
 #include <algorithm>
+#include <limits>
 
 #include "rapidjson/stringbuffer.h"
 
@@ -33,6 +34,7 @@
 #include "apl/datasource/datasource.h"
 #include "apl/datasource/datasourceprovider.h"
 #include "apl/engine/builder.h"
+#include "apl/engine/inputrecorder.h"
 #include "apl/extension/extensionmanager.h"
 #include "apl/engine/rootcontext.h"
 #include "apl/engine/resources.h"
@@ -103,6 +105,9 @@ RootContext::~RootContext() {
 void
 RootContext::configurationChange(const ConfigurationChange& change)
 {
+    if (mInputRecorder)
+        mInputRecorder->recordConfigurationChange(mTimeManager->currentTime(), change);
+
     // If we're in the middle of a configuration change, drop it
     mCore->sequencer().terminateSequencer(ConfigChangeCommand::SEQUENCER);
 
@@ -119,6 +124,9 @@ RootContext::configurationChange(const ConfigurationChange& change)
 void
 RootContext::updateDisplayState(DisplayState displayState)
 {
+    if (mInputRecorder)
+        mInputRecorder->recordDisplayState(mTimeManager->currentTime(), displayState);
+
     if (!sDisplayStateMap.has(displayState)) {
         LOG(LogLevel::kWarn) << "View specified an invalid display state, ignoring it";
         return;
@@ -146,6 +154,9 @@ RootContext::updateDisplayState(DisplayState displayState)
 void
 RootContext::reinflate()
 {
+    if (mInputRecorder)
+        mInputRecorder->recordReinflate(mTimeManager->currentTime());
+
     // The basic algorithm is to simply re-build core and re-inflate the component hierarchy.
     // TODO: Re-use parts of the hierarchy and to maintain state during reinflation.
 
@@ -444,6 +455,9 @@ RootContext::createKeyboardDocumentContext(const std::string& handler, const Obj
 ActionPtr
 RootContext::executeCommands(const apl::Object& commands, bool fastMode)
 {
+    if (mInputRecorder)
+        mInputRecorder->recordExecuteCommands(mTimeManager->currentTime(), commands, fastMode);
+
     ContextPtr ctx = createDocumentContext("External");
     return mContext->sequencer().executeCommands(commands, ctx, nullptr, fastMode);
 }
@@ -452,6 +466,9 @@ ActionPtr
 RootContext::invokeExtensionEventHandler(const std::string& uri, const std::string& name,
                                          const ObjectMap& data, bool fastMode,
                                          std::string resourceId) {
+    if (mInputRecorder)
+        mInputRecorder->recordExtensionEvent(mTimeManager->currentTime(), uri, name, data, fastMode, resourceId);
+
     auto handlerDefinition = ExtensionEventHandler{uri, name};
     auto handler = Object::NULL_OBJECT();
     ContextPtr ctx = nullptr;
@@ -488,6 +505,9 @@ void
 RootContext::cancelExecution()
 {
     assert(mCore);
+    if (mInputRecorder)
+        mInputRecorder->recordCancelExecution(mTimeManager->currentTime());
+
     mCore->sequencer().reset();
 }
 
@@ -518,17 +538,20 @@ RootContext::payloadContext() const
 void
 RootContext::updateTime(apl_time_t elapsedTime)
 {
+    if (mInputRecorder)
+        mInputRecorder->recordUpdateTime(elapsedTime);
+
     // Flush any dynamic data changes
     mCore->dataManager().flushDirty();
 
     auto lastTime = mTimeManager->currentTime();
     mTimeManager->updateTime(elapsedTime);
-    mContext->systemUpdateAndRecalculate(ELAPSED_TIME, mTimeManager->currentTime(), true); // Read back in case it gets changed
+    mContext->systemUpdateClockAndRecalculate(ELAPSED_TIME, mTimeManager->currentTime(), true); // Read back in case it gets changed
 
     // Update the local time by how much time passed on the "elapsed" timer
     mUTCTime += mTimeManager->currentTime() - lastTime;
-    mContext->systemUpdateAndRecalculate(UTC_TIME, mUTCTime, true);
-    mContext->systemUpdateAndRecalculate(LOCAL_TIME, mUTCTime + mLocalTimeAdjustment, true);
+    mContext->systemUpdateClockAndRecalculate(UTC_TIME, mUTCTime, true);
+    mContext->systemUpdateClockAndRecalculate(LOCAL_TIME, mUTCTime + mLocalTimeAdjustment, true);
 
     mCore->pointerManager().handleTimeUpdate(elapsedTime);
 }
@@ -536,15 +559,18 @@ RootContext::updateTime(apl_time_t elapsedTime)
 void
 RootContext::updateTime(apl_time_t elapsedTime, apl_time_t utcTime)
 {
+    if (mInputRecorder)
+        mInputRecorder->recordUpdateTime(elapsedTime, utcTime);
+
     // Flush any dynamic data changes
     mCore->dataManager().flushDirty();
 
     mTimeManager->updateTime(elapsedTime);
-    mContext->systemUpdateAndRecalculate(ELAPSED_TIME, mTimeManager->currentTime(), true); // Read back in case it gets changed
+    mContext->systemUpdateClockAndRecalculate(ELAPSED_TIME, mTimeManager->currentTime(), true); // Read back in case it gets changed
 
     mUTCTime = utcTime;
-    mContext->systemUpdateAndRecalculate(UTC_TIME, mUTCTime, true);
-    mContext->systemUpdateAndRecalculate(LOCAL_TIME, mUTCTime + mLocalTimeAdjustment, true);
+    mContext->systemUpdateClockAndRecalculate(UTC_TIME, mUTCTime, true);
+    mContext->systemUpdateClockAndRecalculate(LOCAL_TIME, mUTCTime + mLocalTimeAdjustment, true);
 
     mCore->pointerManager().handleTimeUpdate(elapsedTime);
 }
@@ -563,7 +589,17 @@ RootContext::scrollToRectInComponent(const ComponentPtr& component, const Rect &
 apl_time_t
 RootContext::nextTime()
 {
-    return mTimeManager->nextTimeout();
+    auto result = mTimeManager->nextTimeout();
+
+    // Data-bindings that depend on a clock need to be refreshed when the clock crosses their next boundary.
+    // The UTC and local clocks are assumed to advance at the same rate as the elapsed time.
+    for (const auto& clock : {ELAPSED_TIME, UTC_TIME, LOCAL_TIME}) {
+        auto delay = mContext->clockBoundaryDelay(clock);
+        if (delay < std::numeric_limits<apl_duration_t>::max())
+            result = std::min(result, mTimeManager->currentTime() + delay);
+    }
+
+    return result;
 }
 
 apl_time_t
@@ -845,6 +881,9 @@ bool
 RootContext::handleKeyboard(KeyHandlerType type, const Keyboard &keyboard) {
 
     assert(mCore);
+    if (mInputRecorder)
+        mInputRecorder->recordKeyboard(mTimeManager->currentTime(), type, keyboard);
+
     auto &km = mCore->keyboardManager();
     auto &fm = mCore->focusManager();
     return km.handleKeyboard(type, fm.getFocus(), keyboard, shared_from_this());
@@ -859,6 +898,9 @@ RootContext::getSession() const
 bool
 RootContext::handlePointerEvent(const PointerEvent& pointerEvent) {
     assert(mCore);
+    if (mInputRecorder)
+        mInputRecorder->recordPointerEvent(mTimeManager->currentTime(), pointerEvent);
+
     return mCore->pointerManager().handlePointerEvent(pointerEvent, mTimeManager->currentTime());
 }
 
@@ -953,6 +995,9 @@ void
 RootContext::mediaLoaded(const std::string& source)
 {
     assert(mCore);
+    if (mInputRecorder)
+        mInputRecorder->recordMediaLoaded(mTimeManager->currentTime(), source);
+
     mCore->mediaManager().mediaLoadComplete(source, true, -1, std::string());
 }
 
@@ -960,6 +1005,9 @@ void
 RootContext::mediaLoadFailed(const std::string& source, int errorCode, const std::string& error)
 {
     assert(mCore);
+    if (mInputRecorder)
+        mInputRecorder->recordMediaLoadFailed(mTimeManager->currentTime(), source, errorCode, error);
+
     mCore->mediaManager().mediaLoadComplete(source, false, errorCode, error);
 }
 
@@ -87,6 +87,8 @@ RootContextData::RootContextData(const Metrics& metrics,
       mDataManager(new LiveDataManager()),
       mExtensionManager(new ExtensionManager(extensions, config)),
       mLayoutManager(new LayoutManager(*this)),
+      mMediaPlayerPool(new MediaPlayerPool(config.getMediaPlayerFactory(),
+                                           config.getProperty(RootProperty::kMediaPlayerPoolSize).getInteger())),
       mYGConfigRef(YGConfigNew()),
       mTextMeasurement(config.getMeasure()),
       mConfig(config),
@@ -18,6 +18,8 @@
 #include "apl/engine/evaluate.h"
 #include "apl/engine/styledefinition.h"
 #include "apl/engine/arrayify.h"
+#include "apl/engine/context.h"
+#include "apl/primitives/symbolreferencemap.h"
 
 #include "apl/utils/log.h"
 
@@ -28,6 +30,53 @@ static const char *WHEN = "when";
 static const char *VALUE = "value";
 static const char *VALUES = "values";
 static const char *DESCRIPTION = "description";
+static const char *STATE = "state";
+static const unsigned int ALL_STATES = (1u << kStatePropertyCount) - 1;
+
+/**
+ * Add the states referenced by the data-binding expressions in a JSON value to the state mask.
+ * @param context A context where "state" is a mutable value, so that references to it are not optimized away.
+ * @param value The JSON value to search.
+ * @param mask The state mask to update.
+ */
+static void
+addStateReferences(const Context& context, const rapidjson::Value& value, unsigned int& mask)
+{
+    if (value.IsString()) {
+        auto result = parseDataBinding(context, value.GetString());
+        if (!result.isEvaluable())
+            return;
+
+        SymbolReferenceMap symbols;
+        result.symbols(symbols);
+
+        const std::string prefix = std::string(STATE) + "/";
+        for (const auto& m : symbols.get()) {
+            const auto& path = m.first;
+            if (path.compare(0, prefix.size(), prefix) != 0)
+                continue;
+
+            // A reference to "state" as a whole (or an index that is not a constant) may observe anything
+            auto name = path.substr(prefix.size(), path.find('/', prefix.size()) - prefix.size());
+            if (name.empty()) {
+                mask = ALL_STATES;
+                return;
+            }
+
+            auto property = State::stringToState(name);
+            if (property >= 0)
+                mask |= 1u << property;
+        }
+    }
+    else if (value.IsArray()) {
+        for (const auto& m : value.GetArray())
+            addStateReferences(context, m, mask);
+    }
+    else if (value.IsObject()) {
+        for (const auto& m : value.GetObject())
+            addStateReferences(context, m.value, mask);
+    }
+}
 
 StyleDefinition::StyleDefinition(const rapidjson::Value& value, const Path& styleProvenance)
     : mStyleProvenance(styleProvenance),
@@ -87,4 +136,24 @@ StyleDefinition::get(const ContextPtr& context, const State& state)
     return ptr;
 }
 
-} // namespace apl
\ No newline at end of file
+unsigned int
+StyleDefinition::stateMask(const ContextPtr& context)
+{
+    if (mStateMaskValid)
+        return mStateMask;
+
+    mStateMask = 0;
+    for (const auto& sd : mExtends)
+        mStateMask |= sd->stateMask(context);
+
+    auto probe = Context::createFromParent(context);
+    probe->putSystemWriteable(STATE, Object::NULL_OBJECT());
+    for (const rapidjson::Value *block : mBlocks)
+        addStateReferences(*probe, *block, mStateMask);
+
+    LOG_IF(DEBUG_STYLES) << "StyleDefinition::stateMask " << mStyleProvenance.toString() << " " << mStateMask;
+    mStateMaskValid = true;
+    return mStateMask;
+}
+
+} // namespace apl
@@ -74,4 +74,35 @@ GraphicElementPath::initialize(const GraphicPtr& graphic, const Object& json)
     return true;
 }
 
+PathGeometryPtr
+GraphicElementPath::getGeometry() const
+{
+    const auto& pathData = getValue(kGraphicPropertyPathData).getString();
+    if (!mGeometry || pathData != mGeometryPathData) {
+        mGeometry = PathGeometry::create(pathData);
+        mGeometryPathData = pathData;
+    }
+
+    return mGeometry;
+}
+
+std::vector<PathInterval>
+GraphicElementPath::getDashIntervals() const
+{
+    auto geometry = getGeometry();
+
+    std::vector<float> pattern;
+    for (const auto& m : getValue(kGraphicPropertyStrokeDashArray).getArray())
+        pattern.push_back(static_cast<float>(m.asNumber()));
+
+    // The "pathLength" property rescales dash distances to the author's idea of the path length
+    auto scale = 1.0f;
+    auto pathLength = getValue(kGraphicPropertyPathLength).asNumber();
+    if (pathLength > 0)
+        scale = static_cast<float>(geometry->getLength() / pathLength);
+
+    return geometry->getDashIntervals(pattern, static_cast<float>(getValue(kGraphicPropertyStrokeDashOffset).asNumber()),
+                                      scale);
+}
+
 }  // namespace apl
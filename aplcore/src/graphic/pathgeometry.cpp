@@ -0,0 +1,660 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+
+#include "apl/graphic/pathgeometry.h"
+
+namespace apl {
+
+static const float DEFAULT_TOLERANCE = 0.25f;
+static const int MAX_CURVE_STEPS = 1000;
+
+// Dash patterns that would generate more dashes than this are drawn solid
+static const float MAX_DASHES_PER_SUBPATH = 1000000;
+
+static inline float
+distance(const Point& a, const Point& b)
+{
+    return std::hypot(b.getX() - a.getX(), b.getY() - a.getY());
+}
+
+static inline Point
+lerp(const Point& a, const Point& b, float t)
+{
+    return { a.getX() + (b.getX() - a.getX()) * t, a.getY() + (b.getY() - a.getY()) * t };
+}
+
+static inline Point
+reflect(const Point& control, const Point& about)
+{
+    return { 2 * about.getX() - control.getX(), 2 * about.getY() - control.getY() };
+}
+
+/**
+ * Number of line segments needed to keep a curve within the tolerance.  The flattening error of a
+ * curve split into n uniform steps is bounded by max|B''| / (8 n^2).
+ */
+static int
+curveSteps(float secondDerivative, float tolerance)
+{
+    auto steps = std::ceil(std::sqrt(secondDerivative / (8 * tolerance)));
+    if (!(steps >= 1))
+        return 1;
+    return std::min(static_cast<int>(steps), MAX_CURVE_STEPS);
+}
+
+/**
+ * Recursive-descent parser for the SVG path grammar.  Numbers may be separated by whitespace, a comma,
+ * a sign or a second decimal point; arc flags may be run together.
+ */
+class PathParser {
+public:
+    PathParser(const std::string& data, PathGeometry& path) : mPtr(data.c_str()), mPath(path) {}
+
+    bool parse() {
+        skipSeparators();
+        if (!*mPtr)
+            return true;
+
+        // A path must start with a moveto command
+        if (*mPtr != 'M' && *mPtr != 'm')
+            return false;
+
+        while (*mPtr) {
+            char command = *mPtr++;
+            if (!parseCommand(command))
+                return false;
+            skipSeparators();
+        }
+
+        return true;
+    }
+
+private:
+    bool parseCommand(char command) {
+        bool relative = std::islower(static_cast<unsigned char>(command));
+        auto origin = relative ? mPath.mCurrent : Point();
+        Point p1, p2, p3;
+
+        switch (command) {
+            case 'M':
+            case 'm':
+                if (!parsePoint(p1, origin))
+                    return false;
+                mPath.moveTo(p1);
+                clearControls();
+                // Additional coordinate pairs are implicit lineto commands
+                while (hasNumber()) {
+                    if (!parsePoint(p1, relative ? mPath.mCurrent : Point()))
+                        return false;
+                    mPath.lineTo(p1);
+                }
+                return true;
+
+            case 'Z':
+            case 'z':
+                mPath.close();
+                clearControls();
+                return true;
+
+            default:
+                break;
+        }
+
+        // Every other command takes one or more argument groups
+        do {
+            origin = relative ? mPath.mCurrent : Point();
+
+            switch (command) {
+                case 'L':
+                case 'l':
+                    if (!parsePoint(p1, origin))
+                        return false;
+                    mPath.lineTo(p1);
+                    clearControls();
+                    break;
+
+                case 'H':
+                case 'h': {
+                    float x;
+                    if (!parseNumber(x))
+                        return false;
+                    mPath.lineTo({x + origin.getX(), mPath.mCurrent.getY()});
+                    clearControls();
+                }
+                    break;
+
+                case 'V':
+                case 'v': {
+                    float y;
+                    if (!parseNumber(y))
+                        return false;
+                    mPath.lineTo({mPath.mCurrent.getX(), y + origin.getY()});
+                    clearControls();
+                }
+                    break;
+
+                case 'C':
+                case 'c':
+                    if (!parsePoint(p1, origin) || !parsePoint(p2, origin) || !parsePoint(p3, origin))
+                        return false;
+                    mPath.cubicTo(p1, p2, p3);
+                    setCubicControl(p2);
+                    break;
+
+                case 'S':
+                case 's':
+                    if (!parsePoint(p2, origin) || !parsePoint(p3, origin))
+                        return false;
+                    p1 = mHasCubicControl ? reflect(mCubicControl, mPath.mCurrent) : mPath.mCurrent;
+                    mPath.cubicTo(p1, p2, p3);
+                    setCubicControl(p2);
+                    break;
+
+                case 'Q':
+                case 'q':
+                    if (!parsePoint(p1, origin) || !parsePoint(p2, origin))
+                        return false;
+                    mPath.quadTo(p1, p2);
+                    setQuadControl(p1);
+                    break;
+
+                case 'T':
+                case 't':
+                    if (!parsePoint(p2, origin))
+                        return false;
+                    p1 = mHasQuadControl ? reflect(mQuadControl, mPath.mCurrent) : mPath.mCurrent;
+                    mPath.quadTo(p1, p2);
+                    setQuadControl(p1);
+                    break;
+
+                case 'A':
+                case 'a': {
+                    float rx, ry, rotation;
+                    bool largeArc, sweep;
+                    if (!parseNumber(rx) || !parseNumber(ry) || !parseNumber(rotation) ||
+                        !parseFlag(largeArc) || !parseFlag(sweep) || !parsePoint(p1, origin))
+                        return false;
+                    arcTo(rx, ry, rotation, largeArc, sweep, p1);
+                    clearControls();
+                }
+                    break;
+
+                default:
+                    return false;
+            }
+        } while (hasNumber());
+
+        return true;
+    }
+
+    /**
+     * Convert an elliptical arc to cubic curves, one per quarter turn or less.  See the SVG implementation
+     * notes, "Conversion from endpoint to center parameterization".
+     */
+    void arcTo(double rx, double ry, double rotation, bool largeArc, bool sweep, const Point& end) {
+        const auto start = mPath.mCurrent;
+        if (start == end)
+            return;
+
+        rx = std::abs(rx);
+        ry = std::abs(ry);
+        if (rx == 0 || ry == 0) {
+            mPath.lineTo(end);
+            return;
+        }
+
+        const double phi = rotation * M_PI / 180;
+        const double cosPhi = std::cos(phi);
+        const double sinPhi = std::sin(phi);
+
+        const double dx2 = (start.getX() - end.getX()) / 2.0;
+        const double dy2 = (start.getY() - end.getY()) / 2.0;
+        const double x1p = cosPhi * dx2 + sinPhi * dy2;
+        const double y1p = -sinPhi * dx2 + cosPhi * dy2;
+
+        // Scale up radii that are too small to reach the end point
+        const double lambda = (x1p * x1p) / (rx * rx) + (y1p * y1p) / (ry * ry);
+        if (lambda > 1) {
+            rx *= std::sqrt(lambda);
+            ry *= std::sqrt(lambda);
+        }
+
+        const double num = rx * rx * ry * ry - rx * rx * y1p * y1p - ry * ry * x1p * x1p;
+        const double den = rx * rx * y1p * y1p + ry * ry * x1p * x1p;
+        double coef = den > 0 ? std::sqrt(std::max(0.0, num / den)) : 0;
+        if (largeArc == sweep)
+            coef = -coef;
+
+        const double cxp = coef * rx * y1p / ry;
+        const double cyp = -coef * ry * x1p / rx;
+        const double cx = cosPhi * cxp - sinPhi * cyp + (start.getX() + end.getX()) / 2.0;
+        const double cy = sinPhi * cxp + cosPhi * cyp + (start.getY() + end.getY()) / 2.0;
+
+        auto angle = [](double ux, double uy, double vx, double vy) {
+            return std::atan2(ux * vy - uy * vx, ux * vx + uy * vy);
+        };
+
+        const double theta = angle(1, 0, (x1p - cxp) / rx, (y1p - cyp) / ry);
+        double delta = angle((x1p - cxp) / rx, (y1p - cyp) / ry, (-x1p - cxp) / rx, (-y1p - cyp) / ry);
+        if (!sweep && delta > 0)
+            delta -= 2 * M_PI;
+        else if (sweep && delta < 0)
+            delta += 2 * M_PI;
+
+        const int segments = std::max(1, static_cast<int>(std::ceil(std::abs(delta) / (M_PI / 2) - 1e-6)));
+        const double step = delta / segments;
+        const double k = 4.0 / 3.0 * std::tan(step / 4);
+
+        auto pointAt = [&](double t) {
+            return Point(static_cast<float>(cx + rx * std::cos(t) * cosPhi - ry * std::sin(t) * sinPhi),
+                         static_cast<float>(cy + rx * std::cos(t) * sinPhi + ry * std::sin(t) * cosPhi));
+        };
+        auto tangentAt = [&](double t) {
+            return Point(static_cast<float>(k * (-rx * std::sin(t) * cosPhi - ry * std::cos(t) * sinPhi)),
+                         static_cast<float>(k * (-rx * std::sin(t) * sinPhi + ry * std::cos(t) * cosPhi)));
+        };
+
+        for (int i = 0; i < segments; i++) {
+            const double t1 = theta + i * step;
+            const double t2 = t1 + step;
+            auto p0 = mPath.mCurrent;
+            auto p3 = i == segments - 1 ? end : pointAt(t2);
+            mPath.cubicTo(p0 + tangentAt(t1), p3 - tangentAt(t2), p3);
+        }
+    }
+
+    void skipSeparators() {
+        while (*mPtr && (std::isspace(static_cast<unsigned char>(*mPtr)) || *mPtr == ','))
+            mPtr++;
+    }
+
+    bool hasNumber() {
+        skipSeparators();
+        return *mPtr == '-' || *mPtr == '+' || *mPtr == '.' || std::isdigit(static_cast<unsigned char>(*mPtr));
+    }
+
+    bool parseNumber(float& value) {
+        skipSeparators();
+
+        // Validate the number format before handing it to strtof, which accepts "inf", hex and so forth
+        const char *p = mPtr;
+        if (*p == '-' || *p == '+')
+            p++;
+        bool digits = false;
+        while (std::isdigit(static_cast<unsigned char>(*p))) { p++; digits = true; }
+        if (*p == '.') {
+            p++;
+            while (std::isdigit(static_cast<unsigned char>(*p))) { p++; digits = true; }
+        }
+        if (!digits)
+            return false;
+        if (*p == 'e' || *p == 'E') {
+            const char *q = p + 1;
+            if (*q == '-' || *q == '+')
+                q++;
+            if (std::isdigit(static_cast<unsigned char>(*q))) {
+                while (std::isdigit(static_cast<unsigned char>(*q)))
+                    q++;
+                p = q;
+            }
+        }
+
+        value = std::strtof(std::string(mPtr, p).c_str(), nullptr);
+        mPtr = p;
+        return std::isfinite(value);
+    }
+
+    bool parseFlag(bool& value) {
+        skipSeparators();
+        if (*mPtr != '0' && *mPtr != '1')
+            return false;
+        value = *mPtr++ == '1';
+        return true;
+    }
+
+    bool parsePoint(Point& point, const Point& origin) {
+        float x, y;
+        if (!parseNumber(x) || !parseNumber(y))
+            return false;
+        point = Point(x, y) + origin;
+        return true;
+    }
+
+    void clearControls() { mHasCubicControl = mHasQuadControl = false; }
+    void setCubicControl(const Point& p) { mCubicControl = p; mHasCubicControl = true; mHasQuadControl = false; }
+    void setQuadControl(const Point& p) { mQuadControl = p; mHasQuadControl = true; mHasCubicControl = false; }
+
+private:
+    const char *mPtr;
+    PathGeometry& mPath;
+    Point mCubicControl;
+    Point mQuadControl;
+    bool mHasCubicControl = false;
+    bool mHasQuadControl = false;
+};
+
+PathGeometryPtr
+PathGeometry::create(const std::string& pathData, float tolerance)
+{
+    auto path = std::make_shared<PathGeometry>(tolerance > 0 ? tolerance : DEFAULT_TOLERANCE);
+    PathParser parser(pathData, *path);
+    path->finish(parser.parse());
+    return path;
+}
+
+void
+PathGeometry::moveTo(const Point& p)
+{
+    mOpen = false;
+    mStart = mCurrent = p;
+}
+
+void
+PathGeometry::addVertex(const Point& p)
+{
+    if (!mOpen) {
+        // The first drawing command of a subpath starts it at the current point
+        mSubpaths.push_back({mPoints.size(), mPoints.size(), false});
+        mDistances.push_back(getLength());
+        mPoints.push_back(mStart);
+        includeInBounds(mStart.getX(), mStart.getY());
+        mOpen = true;
+    }
+
+    mDistances.push_back(mDistances.back() + distance(mPoints.back(), p));
+    mPoints.push_back(p);
+    mSubpaths.back().last = mPoints.size() - 1;
+}
+
+void
+PathGeometry::lineTo(const Point& p)
+{
+    if (!mOpen)
+        mStart = mCurrent;
+
+    addVertex(p);
+    includeInBounds(p.getX(), p.getY());
+    mCurrent = p;
+}
+
+void
+PathGeometry::quadTo(const Point& p1, const Point& p2)
+{
+    if (!mOpen)
+        mStart = mCurrent;
+
+    const auto p0 = mCurrent;
+    const auto d = p0 - p1 - p1 + p2;
+    const int steps = curveSteps(2 * std::hypot(d.getX(), d.getY()), mTolerance);
+    for (int i = 1; i < steps; i++) {
+        const float t = static_cast<float>(i) / steps;
+        addVertex(lerp(lerp(p0, p1, t), lerp(p1, p2, t), t));
+    }
+    addVertex(p2);
+
+    // Extrema of each axis occur where the derivative is zero
+    auto extrema = [&](float a0, float a1, float a2) {
+        const float den = a0 - 2 * a1 + a2;
+        if (den == 0)
+            return;
+        const float t = (a0 - a1) / den;
+        if (t > 0 && t < 1) {
+            auto p = lerp(lerp(p0, p1, t), lerp(p1, p2, t), t);
+            includeInBounds(p.getX(), p.getY());
+        }
+    };
+    extrema(p0.getX(), p1.getX(), p2.getX());
+    extrema(p0.getY(), p1.getY(), p2.getY());
+    includeInBounds(p2.getX(), p2.getY());
+
+    mCurrent = p2;
+}
+
+static inline Point
+cubicPoint(const Point& p0, const Point& p1, const Point& p2, const Point& p3, float t)
+{
+    auto a = lerp(p0, p1, t);
+    auto b = lerp(p1, p2, t);
+    auto c = lerp(p2, p3, t);
+    return lerp(lerp(a, b, t), lerp(b, c, t), t);
+}
+
+void
+PathGeometry::cubicTo(const Point& p1, const Point& p2, const Point& p3)
+{
+    if (!mOpen)
+        mStart = mCurrent;
+
+    const auto p0 = mCurrent;
+    const auto d1 = p0 - p1 - p1 + p2;
+    const auto d2 = p1 - p2 - p2 + p3;
+    const float dd = std::max(std::hypot(d1.getX(), d1.getY()), std::hypot(d2.getX(), d2.getY()));
+    const int steps = curveSteps(6 * dd, mTolerance);
+    for (int i = 1; i < steps; i++)
+        addVertex(cubicPoint(p0, p1, p2, p3, static_cast<float>(i) / steps));
+    addVertex(p3);
+
+    // The derivative is the quadratic a*t^2 + b*t + c (scaled by 3)
+    auto extrema = [&](float a0, float a1, float a2, float a3) {
+        const double a = -a0 + 3 * a1 - 3 * a2 + a3;
+        const double b = 2 * (a0 - 2 * a1 + a2);
+        const double c = a1 - a0;
+        double roots[2];
+        int count = 0;
+        if (std::abs(a) < 1e-12) {
+            if (b != 0)
+                roots[count++] = -c / b;
+        }
+        else {
+            const double disc = b * b - 4 * a * c;
+            if (disc >= 0) {
+                const double s = std::sqrt(disc);
+                roots[count++] = (-b + s) / (2 * a);
+                roots[count++] = (-b - s) / (2 * a);
+            }
+        }
+        for (int i = 0; i < count; i++) {
+            if (roots[i] > 0 && roots[i] < 1) {
+                auto p = cubicPoint(p0, p1, p2, p3, static_cast<float>(roots[i]));
+                includeInBounds(p.getX(), p.getY());
+            }
+        }
+    };
+    extrema(p0.getX(), p1.getX(), p2.getX(), p3.getX());
+    extrema(p0.getY(), p1.getY(), p2.getY(), p3.getY());
+    includeInBounds(p3.getX(), p3.getY());
+
+    mCurrent = p3;
+}
+
+void
+PathGeometry::close()
+{
+    if (mOpen) {
+        if (mCurrent != mStart)
+            addVertex(mStart);
+        mSubpaths.back().closed = true;
+        mOpen = false;
+    }
+
+    mCurrent = mStart;
+}
+
+void
+PathGeometry::includeInBounds(float x, float y)
+{
+    if (!mHasBounds) {
+        mMinX = mMaxX = x;
+        mMinY = mMaxY = y;
+        mHasBounds = true;
+        return;
+    }
+
+    mMinX = std::min(mMinX, x);
+    mMaxX = std::max(mMaxX, x);
+    mMinY = std::min(mMinY, y);
+    mMaxY = std::max(mMaxY, y);
+}
+
+void
+PathGeometry::finish(bool valid)
+{
+    mValid = valid;
+    mOpen = false;
+    if (mHasBounds)
+        mBounds = Rect(mMinX, mMinY, mMaxX - mMinX, mMaxY - mMinY);
+}
+
+size_t
+PathGeometry::locate(float distance) const
+{
+    // Index of the first vertex of the polyline segment containing this distance
+    auto it = std::upper_bound(mDistances.begin(), mDistances.end(), distance);
+    if (it == mDistances.end())
+        return mDistances.size() - 2;
+    auto index = static_cast<size_t>(std::distance(mDistances.begin(), it));
+    return index > 0 ? index - 1 : 0;
+}
+
+Point
+PathGeometry::getPointAtDistance(float distance) const
+{
+    if (mPoints.empty())
+        return {};
+    if (mPoints.size() == 1)
+        return mPoints.front();
+
+    distance = std::max(0.0f, std::min(distance, getLength()));
+    auto index = locate(distance);
+    auto span = mDistances[index + 1] - mDistances[index];
+    auto t = span > 0 ? (distance - mDistances[index]) / span : 0;
+    return lerp(mPoints[index], mPoints[index + 1], t);
+}
+
+std::vector<Point>
+PathGeometry::getSegment(float start, float end) const
+{
+    std::vector<Point> result;
+    start = std::max(0.0f, start);
+    end = std::min(end, getLength());
+    if (mPoints.size() < 2 || start > end)
+        return result;
+
+    result.push_back(getPointAtDistance(start));
+    for (auto index = locate(start) + 1; index < mPoints.size() && mDistances[index] < end; index++) {
+        // Skip the jump between subpaths
+        if (mDistances[index] == mDistances[index - 1] && mPoints[index] != mPoints[index - 1])
+            continue;
+        result.push_back(mPoints[index]);
+    }
+    result.push_back(getPointAtDistance(end));
+    return result;
+}
+
+std::vector<PathInterval>
+PathGeometry::getDashIntervals(const std::vector<float>& pattern, float offset, float scale) const
+{
+    std::vector<PathInterval> result;
+
+    std::vector<float> dashes;
+    dashes.reserve(pattern.size() * 2);
+    double period = 0;
+    bool valid = !pattern.empty();
+    for (const auto& m : pattern) {
+        if (m < 0 || !std::isfinite(m))
+            valid = false;
+        dashes.push_back(m * scale);
+        period += m * scale;
+    }
+    if (dashes.size() % 2 == 1) {
+        dashes.insert(dashes.end(), dashes.begin(), dashes.end());
+        period *= 2;
+    }
+
+    // Prefix sums of the dash pattern locate the starting dash with a binary search
+    std::vector<double> starts(dashes.size() + 1, 0);
+    for (size_t i = 0; i < dashes.size(); i++)
+        starts[i + 1] = starts[i] + dashes[i];
+
+    double phase = 0;
+    if (valid && period > 0 && std::isfinite(offset)) {
+        phase = std::fmod(static_cast<double>(offset) * scale, period);
+        if (phase < 0)
+            phase += period;
+    }
+
+    for (const auto& subpath : mSubpaths) {
+        const float subStart = mDistances[subpath.first];
+        const float subEnd = mDistances[subpath.last];
+        const double length = subEnd - subStart;
+
+        if (!valid || !(period > 0) || length / period > MAX_DASHES_PER_SUBPATH) {
+            result.emplace_back(subStart, subEnd);
+            continue;
+        }
+
+        // The first entry ending at or after the phase.  A zero-length dash right at the phase is included.
+        auto it = std::lower_bound(starts.begin() + 1, starts.end(), phase);
+        auto index = std::min(static_cast<size_t>(std::distance(starts.begin() + 1, it)), dashes.size() - 1);
+        double position = starts[index] - phase;
+
+        while (position < length) {
+            const double end = position + dashes[index];
+            if (index % 2 == 0) {
+                const double a = std::max(position, 0.0);
+                const double b = std::min(end, length);
+                // Zero-length dashes are kept so that round and square caps can be drawn
+                if (b > a || (dashes[index] == 0 && position >= 0))
+                    result.emplace_back(static_cast<float>(subStart + a), static_cast<float>(subStart + b));
+            }
+            position = end;
+            index = (index + 1) % dashes.size();
+        }
+    }
+
+    return result;
+}
+
+bool
+PathGeometry::contains(const Point& point, bool evenOdd) const
+{
+    const float x = point.getX();
+    const float y = point.getY();
+    int winding = 0;
+
+    for (const auto& subpath : mSubpaths) {
+        for (size_t i = subpath.first; i <= subpath.last; i++) {
+            const auto& a = mPoints[i];
+            const auto& b = mPoints[i < subpath.last ? i + 1 : subpath.first];
+            const float cross = (b.getX() - a.getX()) * (y - a.getY()) - (x - a.getX()) * (b.getY() - a.getY());
+            if (a.getY() <= y) {
+                if (b.getY() > y && cross > 0)
+                    winding++;
+            }
+            else if (b.getY() <= y && cross < 0) {
+                winding--;
+            }
+        }
+    }
+
+    return evenOdd ? (winding % 2) != 0 : winding != 0;
+}
+
+} // namespace apl
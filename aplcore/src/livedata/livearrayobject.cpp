@@ -20,6 +20,9 @@
 #include "apl/livedata/livedatamanager.h"
 #include "apl/livedata/layoutrebuilder.h"
 
+#include <cstdlib>
+#include <limits>
+
 namespace apl {
 
 LiveArrayObject::LiveArrayObject(const LiveArrayPtr& liveArray, const ContextPtr& context, const std::string& key)
@@ -93,6 +96,42 @@ LiveArrayObject::flush() {
     mChanges.clear();
 }
 
+void
+LiveArrayObject::recalculateDownstream(Context& context)
+{
+    if (mReplaced) {
+        LiveDataObject::recalculateDownstream(context);
+        return;
+    }
+
+    // Inserting or removing items moves every item after the first such change.  Updates before that
+    // position are not moved by any of the changes.
+    auto shifted = std::numeric_limits<size_t>::max();
+    std::vector<std::pair<size_t, size_t>> updated;
+    for (const auto& change : mChanges) {
+        if (change.command() == LiveArrayChange::UPDATE)
+            updated.emplace_back(change.position(), change.position() + change.count());
+        else
+            shifted = std::min(shifted, change.position());
+    }
+
+    context.recalculateDownstreamMembers(mKey, [&](const std::string& member) {
+        // Anything other than a fixed index, like "length" or an index from the end, may have changed
+        if (member.find_first_not_of("0123456789") != std::string::npos)
+            return true;
+
+        auto index = std::strtoull(member.c_str(), nullptr, 10);
+        if (index >= shifted)
+            return true;
+
+        for (const auto& range : updated) {
+            if (index >= range.first && index < range.second)
+                return true;
+        }
+        return false;
+    }, true);
+}
+
 /**
  * Return the index of the old item and a flag if that item has changed value.
  * The index is -1 if the item is completely new.
@@ -78,6 +78,25 @@ LiveMapObject::flush() {
     mChanged.clear();
 }
 
+void
+LiveMapObject::recalculateDownstream(Context& context)
+{
+    // A replaced map may have lost any of its keys
+    if (mReplaced) {
+        LiveDataObject::recalculateDownstream(context);
+        return;
+    }
+
+    // Removed keys are included, their dependants evaluate to null now
+    std::set<std::string> changed;
+    for (const auto& change : mChanges)
+        changed.emplace(change.key());
+
+    context.recalculateDownstreamMembers(mKey, [&changed](const std::string& member) {
+        return changed.count(member) > 0;
+    }, true);
+}
+
 const std::vector<LiveMapChange>&
 LiveMapObject::getChanges() {
     // If we've been replaced, EVERYTHING has been changed or updated in some way
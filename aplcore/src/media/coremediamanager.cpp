@@ -13,8 +13,11 @@
  * permissions and limitations under the License.
  */
 
-#include <forward_list>
+#include <algorithm>
+#include <limits>
 
+#include "apl/component/corecomponent.h"
+#include "apl/content/rootconfig.h"
 #include "apl/engine/context.h"
 #include "apl/media/coremediamanager.h"
 #include "apl/media/mediaobject.h"
@@ -28,12 +31,14 @@ class CoreMediaObject : public MediaObject {
 public:
     friend class CoreMediaManager;
 
-    CoreMediaObject(std::string url, EventMediaType type, std::weak_ptr<CoreMediaManager> manager, HeaderArray headers)
+    CoreMediaObject(std::string url, EventMediaType type, std::weak_ptr<CoreMediaManager> manager, HeaderArray headers,
+                    unsigned int sequence)
         : mUrl(std::move(url)),
           mMediaType(type),
           mMediaErrorCode(-1),
           mMediaManager(std::move(manager)),
-          mHeaders(std::move(headers))
+          mHeaders(std::move(headers)),
+          mSequence(sequence)
     {}
 
     ~CoreMediaObject() override {
@@ -68,6 +73,24 @@ public:
         }
     }
 
+    /**
+     * @param viewport The viewport rectangle
+     * @return The distance from the viewport to the closest component using this media object.  Media
+     *         that is not associated with any component is treated as visible.
+     */
+    float viewportDistance(const Rect& viewport) const {
+        if (mComponents.empty())
+            return 0;
+
+        auto result = std::numeric_limits<float>::infinity();
+        for (const auto& m : mComponents) {
+            auto component = m.lock();
+            if (component)
+                result = std::min(result, viewport.distanceTo(component->getGlobalBounds()));
+        }
+        return result;
+    }
+
 private:
     State mState = kPending;
     std::string mUrl;
@@ -78,6 +101,8 @@ private:
     std::weak_ptr<CoreMediaManager> mMediaManager;
     MediaObject::CallbackID mCallbackToken = 0;
     HeaderArray mHeaders;
+    unsigned int mSequence;  // Request order, used to break ties between equally distant media
+    std::vector<std::weak_ptr<CoreComponent>> mComponents;
 };
 
 // ********************** CoreMediaManager implementation ********************
@@ -102,19 +127,88 @@ CoreMediaManager::request(const std::string& url, EventMediaType type, const Hea
     }
 
     // Unrecognized URL; create a new media object and add it to the pending pool
-    auto ptr = std::make_shared<CoreMediaObject>(url, type, shared_from_this(), headers);
+    auto ptr = std::make_shared<CoreMediaObject>(url, type, shared_from_this(), headers, mSequence++);
     mObjectMap.emplace(url, ptr);
     mPending.emplace(ptr);
 
     return ptr;
 }
 
+void
+CoreMediaManager::registerComponent(const MediaObjectPtr& mediaObject, const CoreComponentPtr& component)
+{
+    auto ptr = std::dynamic_pointer_cast<CoreMediaObject>(mediaObject);
+    if (!ptr || !component)
+        return;
+
+    for (const auto& m : ptr->mComponents)
+        if (m.lock() == component)
+            return;
+
+    ptr->mComponents.emplace_back(component);
+}
+
 void
 CoreMediaManager::processMediaRequests(const ContextPtr& context)
 {
-    if (mPending.empty())
+    const auto& config = context->getRootConfig();
+    auto cancelDistance = config.getProperty(RootProperty::kMediaRequestCancelDistance).asNumber();
+    auto viewport = Rect(0, 0, context->width(), context->height());
+
+    // Collect the requests that are no longer needed.  Outstanding media that has moved too far from
+    // the viewport goes back into the pending set so that it is requested again if it returns.
+    std::vector<std::pair<std::string, EventMediaType>> cancelled;
+    cancelled.swap(mReleased);
+    if (cancelDistance < 0) {
+        cancelled.clear();
+    } else {
+        for (auto it = mInFlight.begin(); it != mInFlight.end();) {
+            auto ptr = std::static_pointer_cast<CoreMediaObject>(it->second.object.lock());
+            if (ptr && ptr->viewportDistance(viewport) > cancelDistance) {
+                cancelled.emplace_back(it->first, it->second.type);
+                mPending.emplace(ptr);
+                it = mInFlight.erase(it);
+            } else {
+                it++;
+            }
+        }
+    }
+
+    if (mPending.empty() && cancelled.empty())
         return;
 
+    // Order the pending requests by distance from the viewport
+    std::vector<std::pair<float, std::shared_ptr<CoreMediaObject>>> candidates;
+    for (auto it = mPending.begin(); it != mPending.end();) {
+        auto ptr = std::static_pointer_cast<CoreMediaObject>(it->lock());
+        if (!ptr) {
+            it = mPending.erase(it);
+            continue;
+        }
+
+        auto distance = ptr->viewportDistance(viewport);
+        if (cancelDistance < 0 || distance <= cancelDistance)
+            candidates.emplace_back(distance, ptr);
+        it++;
+    }
+
+    std::sort(candidates.begin(), candidates.end(),
+              [](const std::pair<float, std::shared_ptr<CoreMediaObject>>& lhs,
+                 const std::pair<float, std::shared_ptr<CoreMediaObject>>& rhs) {
+                  if (lhs.first != rhs.first)
+                      return lhs.first < rhs.first;
+                  return lhs.second->mSequence < rhs.second->mSequence;
+              });
+
+    auto limit = static_cast<size_t>(config.getProperty(RootProperty::kMaxMediaRequestsInFlight).getInteger());
+    if (limit > 0)
+        candidates.resize(std::min(candidates.size(), limit > mInFlight.size() ? limit - mInFlight.size() : 0));
+
+    for (const auto& m : candidates) {
+        mPending.erase(m.second);
+        mInFlight[m.second->url()] = InFlight{m.second, m.second->type()};
+    }
+
     // Note: We run these in enumerated order to simplify unit tests
     // that expect events to be generated in this order
     static std::vector<EventMediaType> sRequestTypes = {
@@ -122,14 +216,28 @@ CoreMediaManager::processMediaRequests(const ContextPtr& context)
         kEventMediaTypeVectorGraphic,
     };
 
+    for (const auto& type : sRequestTypes) {
+        auto sources = std::make_shared<ObjectArray>();
+        for (const auto& m : cancelled)
+            if (m.second == type)
+                sources->emplace_back(m.first);
+
+        if (!sources->empty()) {
+            EventBag bag;
+            bag.emplace(kEventPropertySource, sources);
+            bag.emplace(kEventPropertyMediaType, type);
+            context->pushEvent(Event(kEventTypeMediaCancel, std::move(bag)));
+        }
+    }
+
     // Generate one media request per type
     // This could be done more efficiently, but it should be replaced with a single request in the future.
     for (const auto& type : sRequestTypes) {
         auto sources = std::make_shared<ObjectArray>();
         auto headers = std::make_shared<ObjectArray>();
-        for (const auto& m : mPending) {
-            auto ptr = m.lock();
-            if (ptr && ptr->type() == type) {
+        for (const auto& m : candidates) {
+            const auto& ptr = m.second;
+            if (ptr->type() == type) {
                 sources->emplace_back(ptr->url());
                 auto urlHeaders = std::make_shared<ObjectArray>();
                 for (const auto& moHeader : ptr->headers()) {
@@ -147,8 +255,6 @@ CoreMediaManager::processMediaRequests(const ContextPtr& context)
             context->pushEvent(Event(kEventTypeMediaRequest, std::move(bag)));
         }
     }
-
-    mPending.clear();
 }
 
 void
@@ -158,6 +264,8 @@ CoreMediaManager::mediaLoadComplete(
     int errorCode,
     const std::string& errorReason)
 {
+    mInFlight.erase(source);
+
     auto it = mObjectMap.find(source);
     if (it == mObjectMap.end())
         return;
@@ -191,6 +299,13 @@ CoreMediaManager::removeMediaObject(const std::string& url)
     if (it != mObjectMap.end())
         mObjectMap.erase(it);
 
+    // The view host may still be fetching this media; let it know that it is no longer needed
+    auto inFlight = mInFlight.find(url);
+    if (inFlight != mInFlight.end() && inFlight->second.object.expired()) {
+        mReleased.emplace_back(url, inFlight->second.type);
+        mInFlight.erase(inFlight);
+    }
+
     // Don't bother to scan the pending set; it will automatically be cleared in the next processMediaRequests call
 }
 
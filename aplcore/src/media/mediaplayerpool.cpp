@@ -0,0 +1,94 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "apl/media/mediaplayerfactory.h"
+#include "apl/media/mediaplayerpool.h"
+
+namespace apl {
+
+MediaPlayerPool::MediaPlayerPool(MediaPlayerFactoryPtr factory, int maxIdle)
+    : mFactory(std::move(factory)),
+      mMaxIdle(maxIdle > 0 ? static_cast<size_t>(maxIdle) : 0)
+{}
+
+MediaPlayerPool::~MediaPlayerPool()
+{
+    clear();
+}
+
+MediaPlayerPtr
+MediaPlayerPool::acquire(MediaPlayerCallback callback)
+{
+    if (mMaxIdle == 0)
+        return mFactory->createPlayer(std::move(callback));
+
+    if (!mIdle.empty()) {
+        auto player = mIdle.back();
+        mIdle.pop_back();
+        mBindings.at(player.get())->callback = std::move(callback);
+        return player;
+    }
+
+    auto binding = std::make_shared<Binding>();
+    binding->callback = std::move(callback);
+    auto player = mFactory->createPlayer([binding](MediaPlayerEventType eventType, const MediaState& mediaState) {
+        if (binding->callback)
+            binding->callback(eventType, mediaState);
+    });
+
+    if (player)
+        mBindings.emplace(player.get(), binding);
+
+    return player;
+}
+
+void
+MediaPlayerPool::release(const MediaPlayerPtr& player)
+{
+    if (!player)
+        return;
+
+    auto it = mBindings.find(player.get());
+    if (it == mBindings.end()) {
+        player->release();
+        return;
+    }
+
+    // Disconnect the old owner before resetting so that the reset does not generate events
+    it->second->callback = nullptr;
+
+    if (mIdle.size() >= mMaxIdle) {
+        mBindings.erase(it);
+        player->release();
+        return;
+    }
+
+    player->halt();
+    player->setTrackList({});
+    mIdle.emplace_back(player);
+}
+
+void
+MediaPlayerPool::clear()
+{
+    for (const auto& m : mIdle) {
+        mBindings.erase(m.get());
+        m->release();
+    }
+
+    mIdle.clear();
+}
+
+} // namespace apl
@@ -13,14 +13,39 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
+
 #include "apl/primitives/characterrange.h"
 #include "apl/primitives/characterrangegrammar.h"
 #include "apl/utils/session.h"
+#include "apl/utils/weakcache.h"
 
 namespace apl {
 
 namespace pegtl = tao::TAO_PEGTL_NAMESPACE;
 
+static WeakCache<CharacterRanges> sCharacterRangesCache;
+static size_t sCharacterRangesCacheInserts = 0;  // Clean out expired entries every so often
+
+CharacterRangesPtr
+CharacterRanges::create(const SessionPtr &session, const std::string& rangeExpression)
+{
+    auto ptr = sCharacterRangesCache.find(rangeExpression);
+    if (ptr)
+        return ptr;
+
+    ptr = std::make_shared<CharacterRanges>(session, rangeExpression);
+
+    // Expressions that fail to parse are not cached so that every use reports the error
+    if (!ptr->mRanges.empty()) {
+        if (++sCharacterRangesCacheInserts % 32 == 0)
+            sCharacterRangesCache.clean();
+        sCharacterRangesCache.insert(rangeExpression, ptr);
+    }
+
+    return ptr;
+}
+
 /**
  * Parse a rangeExpression and return a stack of CharacterRange objects
  * @param rangeExpression String representing 0 or more character ranges
@@ -43,4 +68,118 @@ std::vector<CharacterRangeData> CharacterRanges::parse(const apl::SessionPtr &se
     return std::vector<CharacterRangeData>();
 }
 
+void
+CharacterRanges::compile()
+{
+    for (const auto& range : mRanges)
+        mIntervals.emplace_back(range.lower(), range.upper());
+
+    std::sort(mIntervals.begin(), mIntervals.end());
+
+    // Merge overlapping and adjacent intervals
+    size_t last = 0;
+    for (size_t i = 1 ; i < mIntervals.size() ; i++) {
+        auto& current = mIntervals.at(last);
+        const auto& next = mIntervals.at(i);
+        if (next.first <= current.second || next.first - 1 == current.second)
+            current.second = std::max(current.second, next.second);
+        else
+            mIntervals.at(++last) = next;
+    }
+    if (!mIntervals.empty())
+        mIntervals.resize(last + 1);
+
+    for (const auto& interval : mIntervals) {
+        for (auto wc = interval.first ; wc <= interval.second && wc < static_cast<wchar_t>(mAscii.size()) ; wc++)
+            mAscii.set(static_cast<size_t>(wc));
+    }
+}
+
+bool
+CharacterRanges::isCharacterValid(wchar_t wc) const
+{
+    if (mIntervals.empty())
+        return true;
+
+    if (wc >= 0 && wc < static_cast<wchar_t>(mAscii.size()))
+        return mAscii.test(static_cast<size_t>(wc));
+
+    // Find the first interval that ends at or after the character
+    auto it = std::lower_bound(mIntervals.begin(), mIntervals.end(), wc,
+                               [](const std::pair<wchar_t, wchar_t>& interval, wchar_t value) {
+                                   return interval.second < value;
+                               });
+    return it != mIntervals.end() && it->first <= wc;
 }
+
+/*
+ * Decode the UTF-8 code point starting at ptr and advance ptr past it.  Return false and advance
+ * a single byte if the sequence is malformed.  See unicode.cpp for the encoding rules.
+ */
+static bool
+decodeUTF8(const uint8_t*& ptr, const uint8_t* end, wchar_t& wc)
+{
+    auto byte = *ptr++;
+    if (byte <= 0x7f) {
+        wc = byte;
+        return true;
+    }
+
+    if (byte < 0xc2 || byte > 0xf4)
+        return false;
+
+    size_t trailing = 1 + (byte >= 0xe0) + (byte >= 0xf0);
+    if (static_cast<size_t>(end - ptr) < trailing)
+        return false;
+
+    // Reject overlong forms, UTF-16 surrogates and code points past U+10FFFF (RFC 3629, section 4)
+    auto second = ptr[0];
+    if ((byte == 0xe0 && second < 0xa0) || (byte == 0xed && second > 0x9f) ||
+        (byte == 0xf0 && second < 0x90) || (byte == 0xf4 && second > 0x8f))
+        return false;
+
+    uint32_t value = byte & (0x3f >> trailing);
+    for (size_t i = 0 ; i < trailing ; i++) {
+        if (ptr[i] < 0x80 || ptr[i] > 0xbf)
+            return false;
+        value = (value << 6) | (ptr[i] & 0x3f);
+    }
+
+    ptr += trailing;
+    wc = static_cast<wchar_t>(value);
+    return true;
+}
+
+bool
+CharacterRanges::isValid(const std::string& utf8String) const
+{
+    auto ptr = reinterpret_cast<const uint8_t*>(utf8String.data());
+    auto end = ptr + utf8String.size();
+    wchar_t wc;
+
+    while (ptr < end) {
+        if (!decodeUTF8(ptr, end, wc) || !isCharacterValid(wc))
+            return false;
+    }
+    return true;
+}
+
+std::string
+CharacterRanges::filter(const std::string& utf8String) const
+{
+    std::string result;
+    result.reserve(utf8String.size());
+
+    auto ptr = reinterpret_cast<const uint8_t*>(utf8String.data());
+    auto end = ptr + utf8String.size();
+    wchar_t wc;
+
+    while (ptr < end) {
+        auto start = ptr;
+        if (decodeUTF8(ptr, end, wc) && isCharacterValid(wc))
+            result.append(reinterpret_cast<const char*>(start), ptr - start);
+    }
+    return result;
+}
+
+} // namespace apl
@@ -0,0 +1,669 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+#include "apl/primitives/filterengine.h"
+#include "apl/graphic/graphicfilter.h"
+#include "apl/primitives/filter.h"
+#include "apl/primitives/gradient.h"
+
+namespace apl {
+
+/**
+ * Working image used while running a filter chain: straight-alpha RGBA floats in the range [0,1].
+ */
+struct FilterImage {
+    FilterImage() = default;
+    FilterImage(int width, int height) : width(width), height(height), px(width * height * 4, 0.0f) {}
+
+    int width = 0;
+    int height = 0;
+    std::vector<float> px;
+};
+
+using FilterImagePtr = std::shared_ptr<FilterImage>;
+
+// Columns of floats processed together by the vertical blur pass.  Each tile of the 2r+1 input
+// rows it reads stays in the L1 cache, and the inner loop is contiguous so the compiler vectorizes it.
+static const int BLUR_TILE = 256;
+
+static inline float
+clamp01(float value)
+{
+    return value < 0 ? 0 : (value > 1 ? 1 : value);
+}
+
+static FilterImagePtr
+fromBitmap(const BitmapPtr& bitmap)
+{
+    if (!bitmap)
+        return std::make_shared<FilterImage>();
+
+    auto image = std::make_shared<FilterImage>(bitmap->width, bitmap->height);
+    const auto count = image->px.size();
+    for (size_t i = 0; i < count; i++)
+        image->px[i] = bitmap->pixels[i] * (1.0f / 255.0f);
+    return image;
+}
+
+static BitmapPtr
+toBitmap(const FilterImage& image)
+{
+    auto bitmap = std::make_shared<Bitmap>(image.width, image.height);
+    const auto count = image.px.size();
+    for (size_t i = 0; i < count; i++)
+        bitmap->pixels[i] = static_cast<uint8_t>(std::lround(clamp01(image.px[i]) * 255.0f));
+    return bitmap;
+}
+
+static void
+premultiply(FilterImage& image)
+{
+    for (size_t i = 0; i < image.px.size(); i += 4) {
+        auto a = image.px[i + 3];
+        image.px[i] *= a;
+        image.px[i + 1] *= a;
+        image.px[i + 2] *= a;
+    }
+}
+
+static void
+unpremultiply(FilterImage& image)
+{
+    for (size_t i = 0; i < image.px.size(); i += 4) {
+        auto a = image.px[i + 3];
+        auto scale = a > 0 ? 1.0f / a : 0.0f;
+        image.px[i] = clamp01(image.px[i] * scale);
+        image.px[i + 1] = clamp01(image.px[i + 1] * scale);
+        image.px[i + 2] = clamp01(image.px[i + 2] * scale);
+    }
+}
+
+/**
+ * Gaussian blur with standard deviation sigma (in pixels).  The kernel is separable, so the image
+ * is blurred horizontally and then vertically.  Pixels outside of the image are transparent.
+ */
+static FilterImagePtr
+blur(const FilterImage& source, float sigma)
+{
+    auto result = std::make_shared<FilterImage>(source);
+    if (sigma <= 0 || source.width == 0 || source.height == 0)
+        return result;
+
+    const int radius = static_cast<int>(std::ceil(sigma * 3));
+    const int taps = radius * 2 + 1;
+    std::vector<float> weights(taps);
+    float total = 0;
+    for (int k = 0; k < taps; k++) {
+        auto d = static_cast<float>(k - radius);
+        weights[k] = std::exp(-d * d / (2 * sigma * sigma));
+        total += weights[k];
+    }
+    for (auto& w : weights)
+        w /= total;
+
+    premultiply(*result);
+
+    // Horizontal pass.  Each row is copied into a buffer padded with transparent pixels so the
+    // kernel loop has no bounds checks.
+    const int width = source.width;
+    const int height = source.height;
+    const int rowFloats = width * 4;
+    std::vector<float> padded((width + 2 * radius) * 4, 0.0f);
+    std::vector<float> horizontal(result->px.size());
+    for (int y = 0; y < height; y++) {
+        const float *row = &result->px[y * rowFloats];
+        std::copy(row, row + rowFloats, padded.begin() + radius * 4);
+        float *out = &horizontal[y * rowFloats];
+        for (int x = 0; x < width; x++) {
+            float r = 0, g = 0, b = 0, a = 0;
+            const float *p = &padded[x * 4];
+            for (int k = 0; k < taps; k++, p += 4) {
+                const float w = weights[k];
+                r += w * p[0];
+                g += w * p[1];
+                b += w * p[2];
+                a += w * p[3];
+            }
+            out[x * 4] = r;
+            out[x * 4 + 1] = g;
+            out[x * 4 + 2] = b;
+            out[x * 4 + 3] = a;
+        }
+    }
+
+    // Vertical pass, one tile of columns at a time
+    std::fill(result->px.begin(), result->px.end(), 0.0f);
+    for (int x0 = 0; x0 < rowFloats; x0 += BLUR_TILE) {
+        const int span = std::min(BLUR_TILE, rowFloats - x0);
+        for (int y = 0; y < height; y++) {
+            float *out = &result->px[y * rowFloats + x0];
+            const int k0 = std::max(0, radius - y);
+            const int k1 = std::min(taps, height - y + radius);
+            for (int k = k0; k < k1; k++) {
+                const float w = weights[k];
+                const float *in = &horizontal[(y + k - radius) * rowFloats + x0];
+                for (int i = 0; i < span; i++)
+                    out[i] += w * in[i];
+            }
+        }
+    }
+
+    unpremultiply(*result);
+    return result;
+}
+
+/**
+ * Apply a 3x3 color matrix to the RGB channels, leaving alpha untouched.
+ */
+static FilterImagePtr
+colorMatrix(const FilterImage& source, const float m[9])
+{
+    auto result = std::make_shared<FilterImage>(source);
+    for (size_t i = 0; i < result->px.size(); i += 4) {
+        auto r = source.px[i], g = source.px[i + 1], b = source.px[i + 2];
+        result->px[i] = clamp01(m[0] * r + m[1] * g + m[2] * b);
+        result->px[i + 1] = clamp01(m[3] * r + m[4] * g + m[5] * b);
+        result->px[i + 2] = clamp01(m[6] * r + m[7] * g + m[8] * b);
+    }
+    return result;
+}
+
+static FilterImagePtr
+grayscale(const FilterImage& source, float amount)
+{
+    const float a = 1 - clamp01(amount);
+    const float m[9] = {
+        0.2126f + 0.7874f * a, 0.7152f - 0.7152f * a, 0.0722f - 0.0722f * a,
+        0.2126f - 0.2126f * a, 0.7152f + 0.2848f * a, 0.0722f - 0.0722f * a,
+        0.2126f - 0.2126f * a, 0.7152f - 0.7152f * a, 0.0722f + 0.9278f * a,
+    };
+    return colorMatrix(source, m);
+}
+
+static FilterImagePtr
+saturate(const FilterImage& source, float s)
+{
+    const float m[9] = {
+        0.213f + 0.787f * s, 0.715f - 0.715f * s, 0.072f - 0.072f * s,
+        0.213f - 0.213f * s, 0.715f + 0.285f * s, 0.072f - 0.072f * s,
+        0.213f - 0.213f * s, 0.715f - 0.715f * s, 0.072f + 0.928f * s,
+    };
+    return colorMatrix(source, m);
+}
+
+static FilterImagePtr
+solid(int width, int height, const Color& color)
+{
+    auto result = std::make_shared<FilterImage>(width, height);
+    const float c[4] = { color.red() / 255.0f, color.green() / 255.0f, color.blue() / 255.0f,
+                         color.alpha() / 255.0f };
+    for (size_t i = 0; i < result->px.size(); i += 4)
+        std::copy(c, c + 4, &result->px[i]);
+    return result;
+}
+
+static void
+gradientColor(const std::vector<Color>& colors, const std::vector<double>& stops, double t, float *out)
+{
+    if (colors.empty()) {
+        std::fill(out, out + 4, 0.0f);
+        return;
+    }
+
+    size_t index = 0;
+    while (index < stops.size() && index < colors.size() && stops[index] < t)
+        index++;
+
+    Color low = colors[index == 0 ? 0 : std::min(index - 1, colors.size() - 1)];
+    Color high = colors[std::min(index, colors.size() - 1)];
+    float f = 0;
+    if (index > 0 && index < stops.size() && index < colors.size() && stops[index] > stops[index - 1])
+        f = static_cast<float>((t - stops[index - 1]) / (stops[index] - stops[index - 1]));
+
+    out[0] = (low.red() + (high.red() - low.red()) * f) / 255.0f;
+    out[1] = (low.green() + (high.green() - low.green()) * f) / 255.0f;
+    out[2] = (low.blue() + (high.blue() - low.blue()) * f) / 255.0f;
+    out[3] = (low.alpha() + (high.alpha() - low.alpha()) * f) / 255.0f;
+}
+
+/**
+ * Render a gradient over the full image.  Linear gradients follow the CSS gradient line for the
+ * angle; radial gradients are centered and reach the last color stop at the corners.
+ */
+static FilterImagePtr
+gradient(int width, int height, const Gradient& gradient)
+{
+    auto result = std::make_shared<FilterImage>(width, height);
+    const auto colors = gradient.getColorRange();
+    const auto stops = gradient.getInputRange();
+    const double cx = width / 2.0;
+    const double cy = height / 2.0;
+
+    double dx = 0, dy = 0, length = 1;
+    if (gradient.getType() == Gradient::LINEAR) {
+        const double angle = gradient.getAngle() * M_PI / 180.0;
+        dx = std::sin(angle);
+        dy = -std::cos(angle);
+        length = std::abs(width * dx) + std::abs(height * dy);
+    } else {
+        length = std::sqrt(cx * cx + cy * cy);
+    }
+    if (length <= 0)
+        length = 1;
+
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            const double px = x + 0.5 - cx;
+            const double py = y + 0.5 - cy;
+            const double t = gradient.getType() == Gradient::LINEAR
+                             ? (px * dx + py * dy) / length + 0.5
+                             : std::sqrt(px * px + py * py) / length;
+            gradientColor(colors, stops, std::max(0.0, std::min(1.0, t)), &result->px[(y * width + x) * 4]);
+        }
+    }
+    return result;
+}
+
+/**
+ * Small, fast and reproducible random number generator (xorshift32).
+ */
+class NoiseGenerator {
+public:
+    explicit NoiseGenerator(uint32_t seed) : mState(seed ? seed : 0x9E3779B9u) {}
+
+    float uniform() {
+        mState ^= mState << 13;
+        mState ^= mState >> 17;
+        mState ^= mState << 5;
+        return (mState >> 8) * (1.0f / 16777216.0f);
+    }
+
+    float sample(NoiseFilterKind kind) {
+        if (kind == kFilterNoiseKindUniform)
+            return (uniform() * 2 - 1) * 1.7320508f;  // Unit standard deviation
+
+        // Box-Muller transform
+        auto u1 = std::max(uniform(), 1e-7f);
+        auto u2 = uniform();
+        return std::sqrt(-2 * std::log(u1)) * std::cos(2 * static_cast<float>(M_PI) * u2);
+    }
+
+private:
+    uint32_t mState;
+};
+
+static FilterImagePtr
+noise(const FilterImage& source, NoiseFilterKind kind, float sigma, bool useColor, uint32_t seed)
+{
+    auto result = std::make_shared<FilterImage>(source);
+    NoiseGenerator generator(seed);
+    const float scale = sigma / 255.0f;
+    for (size_t i = 0; i < result->px.size(); i += 4) {
+        auto n = generator.sample(kind) * scale;
+        for (int c = 0; c < 3; c++) {
+            if (useColor && c > 0)
+                n = generator.sample(kind) * scale;
+            result->px[i + c] = clamp01(result->px[i + c] + n);
+        }
+    }
+    return result;
+}
+
+/* Separable blend modes.  cb is the backdrop (destination) and cs the source. */
+static inline float
+blendChannel(BlendMode mode, float cb, float cs)
+{
+    switch (mode) {
+        case kBlendModeMultiply:
+            return cb * cs;
+        case kBlendModeScreen:
+            return cb + cs - cb * cs;
+        case kBlendModeOverlay:
+            return cb <= 0.5f ? 2 * cb * cs : 1 - 2 * (1 - cb) * (1 - cs);
+        case kBlendModeDarken:
+            return std::min(cb, cs);
+        case kBlendModeLighten:
+            return std::max(cb, cs);
+        case kBlendModeColorDodge:
+            if (cb == 0) return 0;
+            return cs >= 1 ? 1 : std::min(1.0f, cb / (1 - cs));
+        case kBlendModeColorBurn:
+            if (cb >= 1) return 1;
+            return cs <= 0 ? 0 : 1 - std::min(1.0f, (1 - cb) / cs);
+        case kBlendModeHardLight:
+            return cs <= 0.5f ? 2 * cb * cs : 1 - 2 * (1 - cb) * (1 - cs);
+        case kBlendModeSoftLight: {
+            if (cs <= 0.5f)
+                return cb - (1 - 2 * cs) * cb * (1 - cb);
+            auto d = cb <= 0.25f ? ((16 * cb - 12) * cb + 4) * cb : std::sqrt(cb);
+            return cb + (2 * cs - 1) * (d - cb);
+        }
+        case kBlendModeDifference:
+            return std::abs(cb - cs);
+        case kBlendModeExclusion:
+            return cb + cs - 2 * cb * cs;
+        default:
+            return cs;
+    }
+}
+
+/* Non-separable blend mode helpers, as defined by the W3C compositing specification */
+static inline float
+lum(const float *c)
+{
+    return 0.3f * c[0] + 0.59f * c[1] + 0.11f * c[2];
+}
+
+static void
+clipColor(float *c)
+{
+    auto l = lum(c);
+    auto n = std::min(c[0], std::min(c[1], c[2]));
+    auto x = std::max(c[0], std::max(c[1], c[2]));
+    for (int i = 0; i < 3; i++) {
+        if (n < 0 && l - n > 0)
+            c[i] = l + (c[i] - l) * l / (l - n);
+        if (x > 1 && x - l > 0)
+            c[i] = l + (c[i] - l) * (1 - l) / (x - l);
+    }
+}
+
+static void
+setLum(float *c, float l)
+{
+    auto d = l - lum(c);
+    for (int i = 0; i < 3; i++)
+        c[i] += d;
+    clipColor(c);
+}
+
+static inline float
+sat(const float *c)
+{
+    return std::max(c[0], std::max(c[1], c[2])) - std::min(c[0], std::min(c[1], c[2]));
+}
+
+static void
+setSat(float *c, float s)
+{
+    int order[3] = {0, 1, 2};
+    std::sort(order, order + 3, [c](int a, int b) { return c[a] < c[b]; });
+    auto& cmin = c[order[0]];
+    auto& cmid = c[order[1]];
+    auto& cmax = c[order[2]];
+    if (cmax > cmin) {
+        cmid = (cmid - cmin) * s / (cmax - cmin);
+        cmax = s;
+    } else {
+        cmid = cmax = 0;
+    }
+    cmin = 0;
+}
+
+static void
+blendPixel(BlendMode mode, const float *cb, const float *cs, float *out)
+{
+    switch (mode) {
+        case kBlendModeHue:
+            std::copy(cs, cs + 3, out);
+            setSat(out, sat(cb));
+            setLum(out, lum(cb));
+            break;
+        case kBlendModeSaturation:
+            std::copy(cb, cb + 3, out);
+            setSat(out, sat(cs));
+            setLum(out, lum(cb));
+            break;
+        case kBlendModeColor:
+            std::copy(cs, cs + 3, out);
+            setLum(out, lum(cb));
+            break;
+        case kBlendModeLuminosity:
+            std::copy(cb, cb + 3, out);
+            setLum(out, lum(cs));
+            break;
+        default:
+            for (int i = 0; i < 3; i++)
+                out[i] = blendChannel(mode, cb[i], cs[i]);
+            break;
+    }
+}
+
+/**
+ * Composite the source over the destination with a blend mode.  The result has the size of the
+ * destination; the source is aligned to the top-left corner.
+ */
+static FilterImagePtr
+blend(const FilterImage& source, const FilterImage& destination, BlendMode mode, int dx = 0, int dy = 0)
+{
+    auto result = std::make_shared<FilterImage>(destination);
+    for (int y = 0; y < destination.height; y++) {
+        const int sy = y - dy;
+        if (sy < 0 || sy >= source.height)
+            continue;
+        for (int x = 0; x < destination.width; x++) {
+            const int sx = x - dx;
+            if (sx < 0 || sx >= source.width)
+                continue;
+
+            const float *cs = &source.px[(sy * source.width + sx) * 4];
+            const float *cb = &destination.px[(y * destination.width + x) * 4];
+            float *out = &result->px[(y * destination.width + x) * 4];
+
+            const float as = cs[3];
+            const float ab = cb[3];
+            const float ao = as + ab * (1 - as);
+            if (ao <= 0) {
+                std::fill(out, out + 4, 0.0f);
+                continue;
+            }
+
+            float mixed[3];
+            blendPixel(mode, cb, cs, mixed);
+            for (int i = 0; i < 3; i++) {
+                const float co = as * (1 - ab) * cs[i] + as * ab * mixed[i] + (1 - as) * ab * cb[i];
+                out[i] = clamp01(co / ao);
+            }
+            out[3] = ao;
+        }
+    }
+    return result;
+}
+
+static double
+dimensionValue(const Object& value)
+{
+    return value.isAbsoluteDimension() ? value.getAbsoluteDimension() : value.asNumber();
+}
+
+/**
+ * Resolve a source or destination index against the image array.
+ * @return The index, or -1 if it is out of range
+ */
+static int
+resolveIndex(const Object& value, size_t size)
+{
+    auto index = value.asInt();
+    if (index < 0)
+        index += static_cast<int>(size);
+    return index >= 0 && index < static_cast<int>(size) ? index : -1;
+}
+
+static void
+forEach(const Object& objects, const std::function<void(const Object&)>& func)
+{
+    if (objects.isArray()) {
+        for (const auto& m : objects.getArray())
+            func(m);
+    } else if (!objects.isNull()) {
+        func(objects);
+    }
+}
+
+BitmapPtr
+FilterEngine::apply(const std::vector<BitmapPtr>& sources, const Object& filters, float pixelsPerDp, uint32_t seed)
+{
+    auto cached = findCached(sources, filters, pixelsPerDp, seed);
+    if (cached)
+        return cached;
+
+    std::vector<FilterImagePtr> images;
+    for (const auto& m : sources)
+        images.emplace_back(fromBitmap(m));
+
+    const int width = images.empty() ? 0 : images.front()->width;
+    const int height = images.empty() ? 0 : images.front()->height;
+    uint32_t noiseSeed = seed;
+
+    forEach(filters, [&](const Object& object) {
+        if (!object.isFilter())
+            return;
+
+        const auto& filter = object.getFilter();
+        FilterImagePtr output;
+        switch (filter.getType()) {
+            case kFilterTypeBlend: {
+                auto source = resolveIndex(filter.getValue(kFilterPropertySource), images.size());
+                auto destination = resolveIndex(filter.getValue(kFilterPropertyDestination), images.size());
+                if (source >= 0 && destination >= 0)
+                    output = blend(*images[source], *images[destination],
+                                   static_cast<BlendMode>(filter.getValue(kFilterPropertyMode).asInt()));
+            }
+                break;
+
+            case kFilterTypeBlur: {
+                auto source = resolveIndex(filter.getValue(kFilterPropertySource), images.size());
+                if (source >= 0)
+                    output = blur(*images[source],
+                                  static_cast<float>(dimensionValue(filter.getValue(kFilterPropertyRadius)) * pixelsPerDp));
+            }
+                break;
+
+            case kFilterTypeColor:
+                output = solid(width, height, filter.getValue(kFilterPropertyColor).asColor());
+                break;
+
+            case kFilterTypeGradient: {
+                auto value = filter.getValue(kFilterPropertyGradient);
+                if (value.isGradient())
+                    output = gradient(width, height, value.getGradient());
+            }
+                break;
+
+            case kFilterTypeGrayscale: {
+                auto source = resolveIndex(filter.getValue(kFilterPropertySource), images.size());
+                if (source >= 0)
+                    output = grayscale(*images[source], static_cast<float>(filter.getValue(kFilterPropertyAmount).asNumber()));
+            }
+                break;
+
+            case kFilterTypeNoise: {
+                auto source = resolveIndex(filter.getValue(kFilterPropertySource), images.size());
+                if (source >= 0)
+                    output = noise(*images[source],
+                                   static_cast<NoiseFilterKind>(filter.getValue(kFilterPropertyKind).asInt()),
+                                   static_cast<float>(filter.getValue(kFilterPropertySigma).asNumber()),
+                                   filter.getValue(kFilterPropertyUseColor).asBoolean(),
+                                   noiseSeed++);
+            }
+                break;
+
+            case kFilterTypeSaturate: {
+                auto source = resolveIndex(filter.getValue(kFilterPropertySource), images.size());
+                if (source >= 0)
+                    output = saturate(*images[source], static_cast<float>(filter.getValue(kFilterPropertyAmount).asNumber()));
+            }
+                break;
+
+            case kFilterTypeExtension:
+                break;
+        }
+
+        if (output)
+            images.emplace_back(output);
+    });
+
+    BitmapPtr result = images.empty() ? nullptr : toBitmap(*images.back());
+    addCached(sources, filters, pixelsPerDp, seed, result);
+    return result;
+}
+
+BitmapPtr
+FilterEngine::applyGraphicFilters(const BitmapPtr& source, const Object& filters, float pixelsPerUnit)
+{
+    std::vector<BitmapPtr> sources = {source};
+    auto cached = findCached(sources, filters, pixelsPerUnit, 0);
+    if (cached)
+        return cached;
+
+    auto image = fromBitmap(source);
+    forEach(filters, [&](const Object& object) {
+        if (!object.isGraphicFilter())
+            return;
+
+        const auto& filter = object.getGraphicFilter();
+        if (filter.getType() != kGraphicFilterTypeDropShadow)
+            return;
+
+        // The shadow is the alpha mask of the element, tinted with the shadow color, blurred and offset
+        auto color = filter.getValue(kGraphicPropertyFilterColor).asColor();
+        auto shadow = solid(image->width, image->height, color);
+        for (size_t i = 3; i < shadow->px.size(); i += 4)
+            shadow->px[i] *= image->px[i];
+
+        shadow = blur(*shadow, static_cast<float>(filter.getValue(kGraphicPropertyFilterRadius).asNumber() * pixelsPerUnit));
+
+        auto offsetShadow = std::make_shared<FilterImage>(image->width, image->height);
+        auto dx = static_cast<int>(std::lround(filter.getValue(kGraphicPropertyFilterHorizontalOffset).asNumber() * pixelsPerUnit));
+        auto dy = static_cast<int>(std::lround(filter.getValue(kGraphicPropertyFilterVerticalOffset).asNumber() * pixelsPerUnit));
+        offsetShadow = blend(*shadow, *offsetShadow, kBlendModeNormal, dx, dy);
+
+        image = blend(*image, *offsetShadow, kBlendModeNormal);
+    });
+
+    auto result = toBitmap(*image);
+    addCached(sources, filters, pixelsPerUnit, 0, result);
+    return result;
+}
+
+BitmapPtr
+FilterEngine::findCached(const std::vector<BitmapPtr>& sources, const Object& filters, float scale, uint32_t seed)
+{
+    for (auto it = mCache.begin(); it != mCache.end(); it++) {
+        if (it->sources == sources && it->scale == scale && it->seed == seed && it->filters == filters) {
+            mCache.splice(mCache.begin(), mCache, it);
+            return mCache.front().result;
+        }
+    }
+    return nullptr;
+}
+
+void
+FilterEngine::addCached(const std::vector<BitmapPtr>& sources, const Object& filters, float scale, uint32_t seed,
+                        const BitmapPtr& result)
+{
+    if (mCacheSize == 0 || !result)
+        return;
+
+    mCache.push_front(CacheEntry{sources, filters, scale, seed, result});
+    while (mCache.size() > mCacheSize)
+        mCache.pop_back();
+}
+
+} // namespace apl
@@ -467,19 +467,72 @@ createArrayMap()
     return map;
 }
 
+static const ObjectMapPtr&
+mathFunctions()
+{
+    static auto sMathFunctions = createMathMap();
+    return sMathFunctions;
+}
+
+static const ObjectMapPtr&
+timeFunctions()
+{
+    static auto sTimeFunctions = createTimeMap();
+    return sTimeFunctions;
+}
+
 void
 createStandardFunctions(Context& context)
 {
     static auto sArrayFunctions = createArrayMap();
-    static auto sMathFunctions = createMathMap();
     // String functions are dependent on RootConfig locale methods
     auto sStringFunctions = createStringMap(context.getLocaleMethods());
-    static auto sTimeFunctions = createTimeMap();
 
     context.putConstant("Array", sArrayFunctions);
-    context.putConstant("Math", sMathFunctions);
+    context.putConstant("Math", mathFunctions());
     context.putConstant("String", sStringFunctions);
-    context.putConstant("Time", sTimeFunctions);
+    context.putConstant("Time", timeFunctions());
+}
+
+apl_duration_t
+clockGranularity(const Object& function, const ObjectArray& args, apl_duration_t divisor)
+{
+    static const std::vector<std::pair<std::string, apl_duration_t>> sExtractGranularity = {
+        {"year",         time::MS_PER_DAY},
+        {"month",        time::MS_PER_DAY},
+        {"date",         time::MS_PER_DAY},
+        {"weekDay",      time::MS_PER_DAY},
+        {"hours",        time::MS_PER_HOUR},
+        {"minutes",      time::MS_PER_MINUTE},
+        {"seconds",      time::MS_PER_SECOND},
+        {"milliseconds", 1},
+    };
+
+    if (!function.isFunction())
+        return 0;
+
+    // Math.floor(clock / N) changes only when the clock crosses a multiple of N
+    if (function == mathFunctions()->at("floor")) {
+        if (args.empty() && divisor >= 1 && divisor == std::floor(divisor))
+            return divisor;
+        return 0;
+    }
+
+    if (divisor != 1)
+        return 0;
+
+    const auto& times = *timeFunctions();
+    if (function == times.at("format"))
+        return args.size() == 1 && args.at(0).isString() ? timegrammar::timeFormatGranularity(args.at(0).getString()) : 0;
+
+    if (!args.empty())
+        return 0;
+
+    for (const auto& m : sExtractGranularity)
+        if (function == times.at(m.first))
+            return m.second;
+
+    return 0;
 }
 
 }  // namespace apl
@@ -87,7 +87,7 @@ Keyboard::compareWithoutRepeat(const Keyboard& other) const {
 
 rapidjson::Value
 Keyboard::serialize(rapidjson::Document::AllocatorType& allocator) const {
-    rapidjson::Value v(rapidjson::kArrayType);
+    rapidjson::Value v(rapidjson::kObjectType);
     v.AddMember("code", rapidjson::Value(mCode.c_str(), allocator).Move(), allocator);
     v.AddMember("key", rapidjson::Value(mKey.c_str(), allocator).Move(), allocator);
     v.AddMember("repeat", mRepeat, allocator);
@@ -100,6 +100,15 @@ Rect::distanceTo(const Point& point) const {
     return std::sqrt(dx*dx + dy*dy);
 }
 
+float
+Rect::distanceTo(const Rect& other) const {
+    auto dx = std::max(0.0f, std::max(other.mX - (mX + mWidth), mX - (other.mX + other.mWidth)));
+    auto dy = std::max(0.0f, std::max(other.mY - (mY + mHeight), mY - (other.mY + other.mHeight)));
+    if (dx == 0) return dy;
+    if (dy == 0) return dx;
+    return std::sqrt(dx*dx + dy*dy);
+}
+
 rapidjson::Value
 Rect::serialize(rapidjson::Document::AllocatorType& allocator) const {
     rapidjson::Value v(rapidjson::kArrayType);
@@ -13,6 +13,8 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
+
 #include "apl/primitives/timegrammar.h"
 
 namespace apl {
@@ -34,5 +36,38 @@ timeToString(const std::string& format, double time)
     return "";
 }
 
+apl_duration_t
+timeFormatGranularity(const std::string& format)
+{
+    apl_duration_t result = time::MS_PER_DAY;
+
+    for (auto it = format.begin() ; it != format.end() ; ) {
+        auto c = *it;
+        auto end = std::find_if(it, format.end(), [c](char x) { return x != c; });
+        auto count = std::distance(it, end);
+        it = end;
+
+        switch (c) {
+            case 'S':  // SSS=milliseconds, SS=centiseconds, S=deciseconds
+                result = std::min(result, count >= 3 ? 1.0 : (count == 2 ? 10.0 : 100.0));
+                break;
+            case 's':
+                result = std::min(result, static_cast<apl_duration_t>(time::MS_PER_SECOND));
+                break;
+            case 'm':
+                result = std::min(result, static_cast<apl_duration_t>(time::MS_PER_MINUTE));
+                break;
+            case 'h':
+            case 'H':
+                result = std::min(result, static_cast<apl_duration_t>(time::MS_PER_HOUR));
+                break;
+            default:  // Years, months, dates and literal characters
+                break;
+        }
+    }
+
+    return result;
+}
+
 } // namespace timegrammar
 } // namespace apl
\ No newline at end of file
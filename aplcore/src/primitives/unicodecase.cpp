@@ -0,0 +1,721 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <vector>
+
+#include "apl/primitives/unicode.h"
+
+namespace apl {
+
+/*
+ * Unicode case mapping.  The tables below were generated from the Unicode 14.0 character database:
+ * the simple mappings of UnicodeData.txt, the unconditional mappings of SpecialCasing.txt and the
+ * canonical combining classes.  The language-sensitive and context-sensitive rules of SpecialCasing.txt
+ * (Final_Sigma and the Lithuanian, Turkish and Azeri rules) are implemented in code.
+ */
+
+/**
+ * A run of code points sharing the same case mapping offset.  The run covers "count" code points,
+ * starting at "start" and spaced "stride" apart.
+ */
+struct CaseRange {
+    uint32_t start;
+    uint16_t count;
+    uint8_t stride;
+    int32_t delta;
+};
+
+/**
+ * A code point that maps to more than one code point.  The mapping is stored as UTF-8.
+ */
+struct SpecialCase {
+    uint32_t codepoint;
+    const char *mapping;
+};
+
+/**
+ * A range of combining marks.  "above" is set for marks with a canonical combining class of 230.
+ */
+struct CombiningRange {
+    uint32_t first;
+    uint32_t last;
+    bool above;
+};
+
+static const CaseRange UPPER_RANGES[] = {
+    {0x0061, 26, 1, -32}, {0x00B5, 1, 1, 743}, {0x00E0, 23, 1, -32}, {0x00F8, 7, 1, -32},
+    {0x00FF, 1, 1, 121}, {0x0101, 24, 2, -1}, {0x0131, 1, 1, -232}, {0x0133, 3, 2, -1},
+    {0x013A, 8, 2, -1}, {0x014B, 23, 2, -1}, {0x017A, 3, 2, -1}, {0x017F, 1, 1, -300},
+    {0x0180, 1, 1, 195}, {0x0183, 2, 2, -1}, {0x0188, 1, 1, -1}, {0x018C, 1, 1, -1},
+    {0x0192, 1, 1, -1}, {0x0195, 1, 1, 97}, {0x0199, 1, 1, -1}, {0x019A, 1, 1, 163},
+    {0x019E, 1, 1, 130}, {0x01A1, 3, 2, -1}, {0x01A8, 1, 1, -1}, {0x01AD, 1, 1, -1},
+    {0x01B0, 1, 1, -1}, {0x01B4, 2, 2, -1}, {0x01B9, 1, 1, -1}, {0x01BD, 1, 1, -1},
+    {0x01BF, 1, 1, 56}, {0x01C5, 1, 1, -1}, {0x01C6, 1, 1, -2}, {0x01C8, 1, 1, -1},
+    {0x01C9, 1, 1, -2}, {0x01CB, 1, 1, -1}, {0x01CC, 1, 1, -2}, {0x01CE, 8, 2, -1},
+    {0x01DD, 1, 1, -79}, {0x01DF, 9, 2, -1}, {0x01F2, 1, 1, -1}, {0x01F3, 1, 1, -2},
+    {0x01F5, 1, 1, -1}, {0x01F9, 20, 2, -1}, {0x0223, 9, 2, -1}, {0x023C, 1, 1, -1},
+    {0x023F, 2, 1, 10815}, {0x0242, 1, 1, -1}, {0x0247, 5, 2, -1}, {0x0250, 1, 1, 10783},
+    {0x0251, 1, 1, 10780}, {0x0252, 1, 1, 10782}, {0x0253, 1, 1, -210}, {0x0254, 1, 1, -206},
+    {0x0256, 2, 1, -205}, {0x0259, 1, 1, -202}, {0x025B, 1, 1, -203}, {0x025C, 1, 1, 42319},
+    {0x0260, 1, 1, -205}, {0x0261, 1, 1, 42315}, {0x0263, 1, 1, -207}, {0x0265, 1, 1, 42280},
+    {0x0266, 1, 1, 42308}, {0x0268, 1, 1, -209}, {0x0269, 1, 1, -211}, {0x026A, 1, 1, 42308},
+    {0x026B, 1, 1, 10743}, {0x026C, 1, 1, 42305}, {0x026F, 1, 1, -211}, {0x0271, 1, 1, 10749},
+    {0x0272, 1, 1, -213}, {0x0275, 1, 1, -214}, {0x027D, 1, 1, 10727}, {0x0280, 1, 1, -218},
+    {0x0282, 1, 1, 42307}, {0x0283, 1, 1, -218}, {0x0287, 1, 1, 42282}, {0x0288, 1, 1, -218},
+    {0x0289, 1, 1, -69}, {0x028A, 2, 1, -217}, {0x028C, 1, 1, -71}, {0x0292, 1, 1, -219},
+    {0x029D, 1, 1, 42261}, {0x029E, 1, 1, 42258}, {0x0345, 1, 1, 84}, {0x0371, 2, 2, -1},
+    {0x0377, 1, 1, -1}, {0x037B, 3, 1, 130}, {0x03AC, 1, 1, -38}, {0x03AD, 3, 1, -37},
+    {0x03B1, 17, 1, -32}, {0x03C2, 1, 1, -31}, {0x03C3, 9, 1, -32}, {0x03CC, 1, 1, -64},
+    {0x03CD, 2, 1, -63}, {0x03D0, 1, 1, -62}, {0x03D1, 1, 1, -57}, {0x03D5, 1, 1, -47},
+    {0x03D6, 1, 1, -54}, {0x03D7, 1, 1, -8}, {0x03D9, 12, 2, -1}, {0x03F0, 1, 1, -86},
+    {0x03F1, 1, 1, -80}, {0x03F2, 1, 1, 7}, {0x03F3, 1, 1, -116}, {0x03F5, 1, 1, -96},
+    {0x03F8, 1, 1, -1}, {0x03FB, 1, 1, -1}, {0x0430, 32, 1, -32}, {0x0450, 16, 1, -80},
+    {0x0461, 17, 2, -1}, {0x048B, 27, 2, -1}, {0x04C2, 7, 2, -1}, {0x04CF, 1, 1, -15},
+    {0x04D1, 48, 2, -1}, {0x0561, 38, 1, -48}, {0x10D0, 43, 1, 3008}, {0x10FD, 3, 1, 3008},
+    {0x13F8, 6, 1, -8}, {0x1C80, 1, 1, -6254}, {0x1C81, 1, 1, -6253}, {0x1C82, 1, 1, -6244},
+    {0x1C83, 2, 1, -6242}, {0x1C85, 1, 1, -6243}, {0x1C86, 1, 1, -6236}, {0x1C87, 1, 1, -6181},
+    {0x1C88, 1, 1, 35266}, {0x1D79, 1, 1, 35332}, {0x1D7D, 1, 1, 3814}, {0x1D8E, 1, 1, 35384},
+    {0x1E01, 75, 2, -1}, {0x1E9B, 1, 1, -59}, {0x1EA1, 48, 2, -1}, {0x1F00, 8, 1, 8},
+    {0x1F10, 6, 1, 8}, {0x1F20, 8, 1, 8}, {0x1F30, 8, 1, 8}, {0x1F40, 6, 1, 8},
+    {0x1F51, 4, 2, 8}, {0x1F60, 8, 1, 8}, {0x1F70, 2, 1, 74}, {0x1F72, 4, 1, 86},
+    {0x1F76, 2, 1, 100}, {0x1F78, 2, 1, 128}, {0x1F7A, 2, 1, 112}, {0x1F7C, 2, 1, 126},
+    {0x1FB0, 2, 1, 8}, {0x1FBE, 1, 1, -7205}, {0x1FD0, 2, 1, 8}, {0x1FE0, 2, 1, 8},
+    {0x1FE5, 1, 1, 7}, {0x214E, 1, 1, -28}, {0x2170, 16, 1, -16}, {0x2184, 1, 1, -1},
+    {0x24D0, 26, 1, -26}, {0x2C30, 48, 1, -48}, {0x2C61, 1, 1, -1}, {0x2C65, 1, 1, -10795},
+    {0x2C66, 1, 1, -10792}, {0x2C68, 3, 2, -1}, {0x2C73, 1, 1, -1}, {0x2C76, 1, 1, -1},
+    {0x2C81, 50, 2, -1}, {0x2CEC, 2, 2, -1}, {0x2CF3, 1, 1, -1}, {0x2D00, 38, 1, -7264},
+    {0x2D27, 1, 1, -7264}, {0x2D2D, 1, 1, -7264}, {0xA641, 23, 2, -1}, {0xA681, 14, 2, -1},
+    {0xA723, 7, 2, -1}, {0xA733, 31, 2, -1}, {0xA77A, 2, 2, -1}, {0xA77F, 5, 2, -1},
+    {0xA78C, 1, 1, -1}, {0xA791, 2, 2, -1}, {0xA794, 1, 1, 48}, {0xA797, 10, 2, -1},
+    {0xA7B5, 8, 2, -1}, {0xA7C8, 2, 2, -1}, {0xA7D1, 1, 1, -1}, {0xA7D7, 2, 2, -1},
+    {0xA7F6, 1, 1, -1}, {0xAB53, 1, 1, -928}, {0xAB70, 80, 1, -38864}, {0xFF41, 26, 1, -32},
+    {0x10428, 40, 1, -40}, {0x104D8, 36, 1, -40}, {0x10597, 11, 1, -39}, {0x105A3, 15, 1, -39},
+    {0x105B3, 7, 1, -39}, {0x105BB, 2, 1, -39}, {0x10CC0, 51, 1, -64}, {0x118C0, 32, 1, -32},
+    {0x16E60, 32, 1, -32}, {0x1E922, 34, 1, -34},
+};
+
+static const CaseRange LOWER_RANGES[] = {
+    {0x0041, 26, 1, 32}, {0x00C0, 23, 1, 32}, {0x00D8, 7, 1, 32}, {0x0100, 24, 2, 1},
+    {0x0132, 3, 2, 1}, {0x0139, 8, 2, 1}, {0x014A, 23, 2, 1}, {0x0178, 1, 1, -121},
+    {0x0179, 3, 2, 1}, {0x0181, 1, 1, 210}, {0x0182, 2, 2, 1}, {0x0186, 1, 1, 206},
+    {0x0187, 1, 1, 1}, {0x0189, 2, 1, 205}, {0x018B, 1, 1, 1}, {0x018E, 1, 1, 79},
+    {0x018F, 1, 1, 202}, {0x0190, 1, 1, 203}, {0x0191, 1, 1, 1}, {0x0193, 1, 1, 205},
+    {0x0194, 1, 1, 207}, {0x0196, 1, 1, 211}, {0x0197, 1, 1, 209}, {0x0198, 1, 1, 1},
+    {0x019C, 1, 1, 211}, {0x019D, 1, 1, 213}, {0x019F, 1, 1, 214}, {0x01A0, 3, 2, 1},
+    {0x01A6, 1, 1, 218}, {0x01A7, 1, 1, 1}, {0x01A9, 1, 1, 218}, {0x01AC, 1, 1, 1},
+    {0x01AE, 1, 1, 218}, {0x01AF, 1, 1, 1}, {0x01B1, 2, 1, 217}, {0x01B3, 2, 2, 1},
+    {0x01B7, 1, 1, 219}, {0x01B8, 1, 1, 1}, {0x01BC, 1, 1, 1}, {0x01C4, 1, 1, 2},
+    {0x01C5, 1, 1, 1}, {0x01C7, 1, 1, 2}, {0x01C8, 1, 1, 1}, {0x01CA, 1, 1, 2},
+    {0x01CB, 9, 2, 1}, {0x01DE, 9, 2, 1}, {0x01F1, 1, 1, 2}, {0x01F2, 2, 2, 1},
+    {0x01F6, 1, 1, -97}, {0x01F7, 1, 1, -56}, {0x01F8, 20, 2, 1}, {0x0220, 1, 1, -130},
+    {0x0222, 9, 2, 1}, {0x023A, 1, 1, 10795}, {0x023B, 1, 1, 1}, {0x023D, 1, 1, -163},
+    {0x023E, 1, 1, 10792}, {0x0241, 1, 1, 1}, {0x0243, 1, 1, -195}, {0x0244, 1, 1, 69},
+    {0x0245, 1, 1, 71}, {0x0246, 5, 2, 1}, {0x0370, 2, 2, 1}, {0x0376, 1, 1, 1},
+    {0x037F, 1, 1, 116}, {0x0386, 1, 1, 38}, {0x0388, 3, 1, 37}, {0x038C, 1, 1, 64},
+    {0x038E, 2, 1, 63}, {0x0391, 17, 1, 32}, {0x03A3, 9, 1, 32}, {0x03CF, 1, 1, 8},
+    {0x03D8, 12, 2, 1}, {0x03F4, 1, 1, -60}, {0x03F7, 1, 1, 1}, {0x03F9, 1, 1, -7},
+    {0x03FA, 1, 1, 1}, {0x03FD, 3, 1, -130}, {0x0400, 16, 1, 80}, {0x0410, 32, 1, 32},
+    {0x0460, 17, 2, 1}, {0x048A, 27, 2, 1}, {0x04C0, 1, 1, 15}, {0x04C1, 7, 2, 1},
+    {0x04D0, 48, 2, 1}, {0x0531, 38, 1, 48}, {0x10A0, 38, 1, 7264}, {0x10C7, 1, 1, 7264},
+    {0x10CD, 1, 1, 7264}, {0x13A0, 80, 1, 38864}, {0x13F0, 6, 1, 8}, {0x1C90, 43, 1, -3008},
+    {0x1CBD, 3, 1, -3008}, {0x1E00, 75, 2, 1}, {0x1E9E, 1, 1, -7615}, {0x1EA0, 48, 2, 1},
+    {0x1F08, 8, 1, -8}, {0x1F18, 6, 1, -8}, {0x1F28, 8, 1, -8}, {0x1F38, 8, 1, -8},
+    {0x1F48, 6, 1, -8}, {0x1F59, 4, 2, -8}, {0x1F68, 8, 1, -8}, {0x1F88, 8, 1, -8},
+    {0x1F98, 8, 1, -8}, {0x1FA8, 8, 1, -8}, {0x1FB8, 2, 1, -8}, {0x1FBA, 2, 1, -74},
+    {0x1FBC, 1, 1, -9}, {0x1FC8, 4, 1, -86}, {0x1FCC, 1, 1, -9}, {0x1FD8, 2, 1, -8},
+    {0x1FDA, 2, 1, -100}, {0x1FE8, 2, 1, -8}, {0x1FEA, 2, 1, -112}, {0x1FEC, 1, 1, -7},
+    {0x1FF8, 2, 1, -128}, {0x1FFA, 2, 1, -126}, {0x1FFC, 1, 1, -9}, {0x2126, 1, 1, -7517},
+    {0x212A, 1, 1, -8383}, {0x212B, 1, 1, -8262}, {0x2132, 1, 1, 28}, {0x2160, 16, 1, 16},
+    {0x2183, 1, 1, 1}, {0x24B6, 26, 1, 26}, {0x2C00, 48, 1, 48}, {0x2C60, 1, 1, 1},
+    {0x2C62, 1, 1, -10743}, {0x2C63, 1, 1, -3814}, {0x2C64, 1, 1, -10727}, {0x2C67, 3, 2, 1},
+    {0x2C6D, 1, 1, -10780}, {0x2C6E, 1, 1, -10749}, {0x2C6F, 1, 1, -10783}, {0x2C70, 1, 1, -10782},
+    {0x2C72, 1, 1, 1}, {0x2C75, 1, 1, 1}, {0x2C7E, 2, 1, -10815}, {0x2C80, 50, 2, 1},
+    {0x2CEB, 2, 2, 1}, {0x2CF2, 1, 1, 1}, {0xA640, 23, 2, 1}, {0xA680, 14, 2, 1},
+    {0xA722, 7, 2, 1}, {0xA732, 31, 2, 1}, {0xA779, 2, 2, 1}, {0xA77D, 1, 1, -35332},
+    {0xA77E, 5, 2, 1}, {0xA78B, 1, 1, 1}, {0xA78D, 1, 1, -42280}, {0xA790, 2, 2, 1},
+    {0xA796, 10, 2, 1}, {0xA7AA, 1, 1, -42308}, {0xA7AB, 1, 1, -42319}, {0xA7AC, 1, 1, -42315},
+    {0xA7AD, 1, 1, -42305}, {0xA7AE, 1, 1, -42308}, {0xA7B0, 1, 1, -42258}, {0xA7B1, 1, 1, -42282},
+    {0xA7B2, 1, 1, -42261}, {0xA7B3, 1, 1, 928}, {0xA7B4, 8, 2, 1}, {0xA7C4, 1, 1, -48},
+    {0xA7C5, 1, 1, -42307}, {0xA7C6, 1, 1, -35384}, {0xA7C7, 2, 2, 1}, {0xA7D0, 1, 1, 1},
+    {0xA7D6, 2, 2, 1}, {0xA7F5, 1, 1, 1}, {0xFF21, 26, 1, 32}, {0x10400, 40, 1, 40},
+    {0x104B0, 36, 1, 40}, {0x10570, 11, 1, 39}, {0x1057C, 15, 1, 39}, {0x1058C, 7, 1, 39},
+    {0x10594, 2, 1, 39}, {0x10C80, 51, 1, 64}, {0x118A0, 32, 1, 32}, {0x16E40, 32, 1, 32},
+    {0x1E900, 34, 1, 34},
+};
+
+static const SpecialCase UPPER_SPECIAL[] = {
+    {0x00DF, "\x53\x53"},  // U+0053 U+0053
+    {0x0149, "\xca\xbc\x4e"},  // U+02BC U+004E
+    {0x01F0, "\x4a\xcc\x8c"},  // U+004A U+030C
+    {0x0390, "\xce\x99\xcc\x88\xcc\x81"},  // U+0399 U+0308 U+0301
+    {0x03B0, "\xce\xa5\xcc\x88\xcc\x81"},  // U+03A5 U+0308 U+0301
+    {0x0587, "\xd4\xb5\xd5\x92"},  // U+0535 U+0552
+    {0x1E96, "\x48\xcc\xb1"},  // U+0048 U+0331
+    {0x1E97, "\x54\xcc\x88"},  // U+0054 U+0308
+    {0x1E98, "\x57\xcc\x8a"},  // U+0057 U+030A
+    {0x1E99, "\x59\xcc\x8a"},  // U+0059 U+030A
+    {0x1E9A, "\x41\xca\xbe"},  // U+0041 U+02BE
+    {0x1F50, "\xce\xa5\xcc\x93"},  // U+03A5 U+0313
+    {0x1F52, "\xce\xa5\xcc\x93\xcc\x80"},  // U+03A5 U+0313 U+0300
+    {0x1F54, "\xce\xa5\xcc\x93\xcc\x81"},  // U+03A5 U+0313 U+0301
+    {0x1F56, "\xce\xa5\xcc\x93\xcd\x82"},  // U+03A5 U+0313 U+0342
+    {0x1F80, "\xe1\xbc\x88\xce\x99"},  // U+1F08 U+0399
+    {0x1F81, "\xe1\xbc\x89\xce\x99"},  // U+1F09 U+0399
+    {0x1F82, "\xe1\xbc\x8a\xce\x99"},  // U+1F0A U+0399
+    {0x1F83, "\xe1\xbc\x8b\xce\x99"},  // U+1F0B U+0399
+    {0x1F84, "\xe1\xbc\x8c\xce\x99"},  // U+1F0C U+0399
+    {0x1F85, "\xe1\xbc\x8d\xce\x99"},  // U+1F0D U+0399
+    {0x1F86, "\xe1\xbc\x8e\xce\x99"},  // U+1F0E U+0399
+    {0x1F87, "\xe1\xbc\x8f\xce\x99"},  // U+1F0F U+0399
+    {0x1F88, "\xe1\xbc\x88\xce\x99"},  // U+1F08 U+0399
+    {0x1F89, "\xe1\xbc\x89\xce\x99"},  // U+1F09 U+0399
+    {0x1F8A, "\xe1\xbc\x8a\xce\x99"},  // U+1F0A U+0399
+    {0x1F8B, "\xe1\xbc\x8b\xce\x99"},  // U+1F0B U+0399
+    {0x1F8C, "\xe1\xbc\x8c\xce\x99"},  // U+1F0C U+0399
+    {0x1F8D, "\xe1\xbc\x8d\xce\x99"},  // U+1F0D U+0399
+    {0x1F8E, "\xe1\xbc\x8e\xce\x99"},  // U+1F0E U+0399
+    {0x1F8F, "\xe1\xbc\x8f\xce\x99"},  // U+1F0F U+0399
+    {0x1F90, "\xe1\xbc\xa8\xce\x99"},  // U+1F28 U+0399
+    {0x1F91, "\xe1\xbc\xa9\xce\x99"},  // U+1F29 U+0399
+    {0x1F92, "\xe1\xbc\xaa\xce\x99"},  // U+1F2A U+0399
+    {0x1F93, "\xe1\xbc\xab\xce\x99"},  // U+1F2B U+0399
+    {0x1F94, "\xe1\xbc\xac\xce\x99"},  // U+1F2C U+0399
+    {0x1F95, "\xe1\xbc\xad\xce\x99"},  // U+1F2D U+0399
+    {0x1F96, "\xe1\xbc\xae\xce\x99"},  // U+1F2E U+0399
+    {0x1F97, "\xe1\xbc\xaf\xce\x99"},  // U+1F2F U+0399
+    {0x1F98, "\xe1\xbc\xa8\xce\x99"},  // U+1F28 U+0399
+    {0x1F99, "\xe1\xbc\xa9\xce\x99"},  // U+1F29 U+0399
+    {0x1F9A, "\xe1\xbc\xaa\xce\x99"},  // U+1F2A U+0399
+    {0x1F9B, "\xe1\xbc\xab\xce\x99"},  // U+1F2B U+0399
+    {0x1F9C, "\xe1\xbc\xac\xce\x99"},  // U+1F2C U+0399
+    {0x1F9D, "\xe1\xbc\xad\xce\x99"},  // U+1F2D U+0399
+    {0x1F9E, "\xe1\xbc\xae\xce\x99"},  // U+1F2E U+0399
+    {0x1F9F, "\xe1\xbc\xaf\xce\x99"},  // U+1F2F U+0399
+    {0x1FA0, "\xe1\xbd\xa8\xce\x99"},  // U+1F68 U+0399
+    {0x1FA1, "\xe1\xbd\xa9\xce\x99"},  // U+1F69 U+0399
+    {0x1FA2, "\xe1\xbd\xaa\xce\x99"},  // U+1F6A U+0399
+    {0x1FA3, "\xe1\xbd\xab\xce\x99"},  // U+1F6B U+0399
+    {0x1FA4, "\xe1\xbd\xac\xce\x99"},  // U+1F6C U+0399
+    {0x1FA5, "\xe1\xbd\xad\xce\x99"},  // U+1F6D U+0399
+    {0x1FA6, "\xe1\xbd\xae\xce\x99"},  // U+1F6E U+0399
+    {0x1FA7, "\xe1\xbd\xaf\xce\x99"},  // U+1F6F U+0399
+    {0x1FA8, "\xe1\xbd\xa8\xce\x99"},  // U+1F68 U+0399
+    {0x1FA9, "\xe1\xbd\xa9\xce\x99"},  // U+1F69 U+0399
+    {0x1FAA, "\xe1\xbd\xaa\xce\x99"},  // U+1F6A U+0399
+    {0x1FAB, "\xe1\xbd\xab\xce\x99"},  // U+1F6B U+0399
+    {0x1FAC, "\xe1\xbd\xac\xce\x99"},  // U+1F6C U+0399
+    {0x1FAD, "\xe1\xbd\xad\xce\x99"},  // U+1F6D U+0399
+    {0x1FAE, "\xe1\xbd\xae\xce\x99"},  // U+1F6E U+0399
+    {0x1FAF, "\xe1\xbd\xaf\xce\x99"},  // U+1F6F U+0399
+    {0x1FB2, "\xe1\xbe\xba\xce\x99"},  // U+1FBA U+0399
+    {0x1FB3, "\xce\x91\xce\x99"},  // U+0391 U+0399
+    {0x1FB4, "\xce\x86\xce\x99"},  // U+0386 U+0399
+    {0x1FB6, "\xce\x91\xcd\x82"},  // U+0391 U+0342
+    {0x1FB7, "\xce\x91\xcd\x82\xce\x99"},  // U+0391 U+0342 U+0399
+    {0x1FBC, "\xce\x91\xce\x99"},  // U+0391 U+0399
+    {0x1FC2, "\xe1\xbf\x8a\xce\x99"},  // U+1FCA U+0399
+    {0x1FC3, "\xce\x97\xce\x99"},  // U+0397 U+0399
+    {0x1FC4, "\xce\x89\xce\x99"},  // U+0389 U+0399
+    {0x1FC6, "\xce\x97\xcd\x82"},  // U+0397 U+0342
+    {0x1FC7, "\xce\x97\xcd\x82\xce\x99"},  // U+0397 U+0342 U+0399
+    {0x1FCC, "\xce\x97\xce\x99"},  // U+0397 U+0399
+    {0x1FD2, "\xce\x99\xcc\x88\xcc\x80"},  // U+0399 U+0308 U+0300
+    {0x1FD3, "\xce\x99\xcc\x88\xcc\x81"},  // U+0399 U+0308 U+0301
+    {0x1FD6, "\xce\x99\xcd\x82"},  // U+0399 U+0342
+    {0x1FD7, "\xce\x99\xcc\x88\xcd\x82"},  // U+0399 U+0308 U+0342
+    {0x1FE2, "\xce\xa5\xcc\x88\xcc\x80"},  // U+03A5 U+0308 U+0300
+    {0x1FE3, "\xce\xa5\xcc\x88\xcc\x81"},  // U+03A5 U+0308 U+0301
+    {0x1FE4, "\xce\xa1\xcc\x93"},  // U+03A1 U+0313
+    {0x1FE6, "\xce\xa5\xcd\x82"},  // U+03A5 U+0342
+    {0x1FE7, "\xce\xa5\xcc\x88\xcd\x82"},  // U+03A5 U+0308 U+0342
+    {0x1FF2, "\xe1\xbf\xba\xce\x99"},  // U+1FFA U+0399
+    {0x1FF3, "\xce\xa9\xce\x99"},  // U+03A9 U+0399
+    {0x1FF4, "\xce\x8f\xce\x99"},  // U+038F U+0399
+    {0x1FF6, "\xce\xa9\xcd\x82"},  // U+03A9 U+0342
+    {0x1FF7, "\xce\xa9\xcd\x82\xce\x99"},  // U+03A9 U+0342 U+0399
+    {0x1FFC, "\xce\xa9\xce\x99"},  // U+03A9 U+0399
+    {0xFB00, "\x46\x46"},  // U+0046 U+0046
+    {0xFB01, "\x46\x49"},  // U+0046 U+0049
+    {0xFB02, "\x46\x4c"},  // U+0046 U+004C
+    {0xFB03, "\x46\x46\x49"},  // U+0046 U+0046 U+0049
+    {0xFB04, "\x46\x46\x4c"},  // U+0046 U+0046 U+004C
+    {0xFB05, "\x53\x54"},  // U+0053 U+0054
+    {0xFB06, "\x53\x54"},  // U+0053 U+0054
+    {0xFB13, "\xd5\x84\xd5\x86"},  // U+0544 U+0546
+    {0xFB14, "\xd5\x84\xd4\xb5"},  // U+0544 U+0535
+    {0xFB15, "\xd5\x84\xd4\xbb"},  // U+0544 U+053B
+    {0xFB16, "\xd5\x8e\xd5\x86"},  // U+054E U+0546
+    {0xFB17, "\xd5\x84\xd4\xbd"},  // U+0544 U+053D
+};
+
+static const SpecialCase LOWER_SPECIAL[] = {
+    {0x0130, "\x69\xcc\x87"},  // U+0069 U+0307
+};
+
+static const CombiningRange COMBINING_RANGES[] = {
+    {0x0300, 0x0314, true}, {0x0315, 0x033C, false}, {0x033D, 0x0344, true}, {0x0345, 0x0345, false},
+    {0x0346, 0x0346, true}, {0x0347, 0x0349, false}, {0x034A, 0x034C, true}, {0x034D, 0x034E, false},
+    {0x0350, 0x0352, true}, {0x0353, 0x0356, false}, {0x0357, 0x0357, true}, {0x0358, 0x035A, false},
+    {0x035B, 0x035B, true}, {0x035C, 0x0362, false}, {0x0363, 0x036F, true}, {0x0483, 0x0487, true},
+    {0x0591, 0x0591, false}, {0x0592, 0x0595, true}, {0x0596, 0x0596, false}, {0x0597, 0x0599, true},
+    {0x059A, 0x059B, false}, {0x059C, 0x05A1, true}, {0x05A2, 0x05A7, false}, {0x05A8, 0x05A9, true},
+    {0x05AA, 0x05AA, false}, {0x05AB, 0x05AC, true}, {0x05AD, 0x05AE, false}, {0x05AF, 0x05AF, true},
+    {0x05B0, 0x05BD, false}, {0x05BF, 0x05BF, false}, {0x05C1, 0x05C2, false}, {0x05C4, 0x05C4, true},
+    {0x05C5, 0x05C5, false}, {0x05C7, 0x05C7, false}, {0x0610, 0x0617, true}, {0x0618, 0x061A, false},
+    {0x064B, 0x0652, false}, {0x0653, 0x0654, true}, {0x0655, 0x0656, false}, {0x0657, 0x065B, true},
+    {0x065C, 0x065C, false}, {0x065D, 0x065E, true}, {0x065F, 0x065F, false}, {0x0670, 0x0670, false},
+    {0x06D6, 0x06DC, true}, {0x06DF, 0x06E2, true}, {0x06E3, 0x06E3, false}, {0x06E4, 0x06E4, true},
+    {0x06E7, 0x06E8, true}, {0x06EA, 0x06EA, false}, {0x06EB, 0x06EC, true}, {0x06ED, 0x06ED, false},
+    {0x0711, 0x0711, false}, {0x0730, 0x0730, true}, {0x0731, 0x0731, false}, {0x0732, 0x0733, true},
+    {0x0734, 0x0734, false}, {0x0735, 0x0736, true}, {0x0737, 0x0739, false}, {0x073A, 0x073A, true},
+    {0x073B, 0x073C, false}, {0x073D, 0x073D, true}, {0x073E, 0x073E, false}, {0x073F, 0x0741, true},
+    {0x0742, 0x0742, false}, {0x0743, 0x0743, true}, {0x0744, 0x0744, false}, {0x0745, 0x0745, true},
+    {0x0746, 0x0746, false}, {0x0747, 0x0747, true}, {0x0748, 0x0748, false}, {0x0749, 0x074A, true},
+    {0x07EB, 0x07F1, true}, {0x07F2, 0x07F2, false}, {0x07F3, 0x07F3, true}, {0x07FD, 0x07FD, false},
+    {0x0816, 0x0819, true}, {0x081B, 0x0823, true}, {0x0825, 0x0827, true}, {0x0829, 0x082D, true},
+    {0x0859, 0x085B, false}, {0x0898, 0x0898, true}, {0x0899, 0x089B, false}, {0x089C, 0x089F, true},
+    {0x08CA, 0x08CE, true}, {0x08CF, 0x08D3, false}, {0x08D4, 0x08E1, true}, {0x08E3, 0x08E3, false},
+    {0x08E4, 0x08E5, true}, {0x08E6, 0x08E6, false}, {0x08E7, 0x08E8, true}, {0x08E9, 0x08E9, false},
+    {0x08EA, 0x08EC, true}, {0x08ED, 0x08F2, false}, {0x08F3, 0x08F5, true}, {0x08F6, 0x08F6, false},
+    {0x08F7, 0x08F8, true}, {0x08F9, 0x08FA, false}, {0x08FB, 0x08FF, true}, {0x093C, 0x093C, false},
+    {0x094D, 0x094D, false}, {0x0951, 0x0951, true}, {0x0952, 0x0952, false}, {0x0953, 0x0954, true},
+    {0x09BC, 0x09BC, false}, {0x09CD, 0x09CD, false}, {0x09FE, 0x09FE, true}, {0x0A3C, 0x0A3C, false},
+    {0x0A4D, 0x0A4D, false}, {0x0ABC, 0x0ABC, false}, {0x0ACD, 0x0ACD, false}, {0x0B3C, 0x0B3C, false},
+    {0x0B4D, 0x0B4D, false}, {0x0BCD, 0x0BCD, false}, {0x0C3C, 0x0C3C, false}, {0x0C4D, 0x0C4D, false},
+    {0x0C55, 0x0C56, false}, {0x0CBC, 0x0CBC, false}, {0x0CCD, 0x0CCD, false}, {0x0D3B, 0x0D3C, false},
+    {0x0D4D, 0x0D4D, false}, {0x0DCA, 0x0DCA, false}, {0x0E38, 0x0E3A, false}, {0x0E48, 0x0E4B, false},
+    {0x0EB8, 0x0EBA, false}, {0x0EC8, 0x0ECB, false}, {0x0F18, 0x0F19, false}, {0x0F35, 0x0F35, false},
+    {0x0F37, 0x0F37, false}, {0x0F39, 0x0F39, false}, {0x0F71, 0x0F72, false}, {0x0F74, 0x0F74, false},
+    {0x0F7A, 0x0F7D, false}, {0x0F80, 0x0F80, false}, {0x0F82, 0x0F83, true}, {0x0F84, 0x0F84, false},
+    {0x0F86, 0x0F87, true}, {0x0FC6, 0x0FC6, false}, {0x1037, 0x1037, false}, {0x1039, 0x103A, false},
+    {0x108D, 0x108D, false}, {0x135D, 0x135F, true}, {0x1714, 0x1715, false}, {0x1734, 0x1734, false},
+    {0x17D2, 0x17D2, false}, {0x17DD, 0x17DD, true}, {0x18A9, 0x18A9, false}, {0x1939, 0x1939, false},
+    {0x193A, 0x193A, true}, {0x193B, 0x193B, false}, {0x1A17, 0x1A17, true}, {0x1A18, 0x1A18, false},
+    {0x1A60, 0x1A60, false}, {0x1A75, 0x1A7C, true}, {0x1A7F, 0x1A7F, false}, {0x1AB0, 0x1AB4, true},
+    {0x1AB5, 0x1ABA, false}, {0x1ABB, 0x1ABC, true}, {0x1ABD, 0x1ABD, false}, {0x1ABF, 0x1AC0, false},
+    {0x1AC1, 0x1AC2, true}, {0x1AC3, 0x1AC4, false}, {0x1AC5, 0x1AC9, true}, {0x1ACA, 0x1ACA, false},
+    {0x1ACB, 0x1ACE, true}, {0x1B34, 0x1B34, false}, {0x1B44, 0x1B44, false}, {0x1B6B, 0x1B6B, true},
+    {0x1B6C, 0x1B6C, false}, {0x1B6D, 0x1B73, true}, {0x1BAA, 0x1BAB, false}, {0x1BE6, 0x1BE6, false},
+    {0x1BF2, 0x1BF3, false}, {0x1C37, 0x1C37, false}, {0x1CD0, 0x1CD2, true}, {0x1CD4, 0x1CD9, false},
+    {0x1CDA, 0x1CDB, true}, {0x1CDC, 0x1CDF, false}, {0x1CE0, 0x1CE0, true}, {0x1CE2, 0x1CE8, false},
+    {0x1CED, 0x1CED, false}, {0x1CF4, 0x1CF4, true}, {0x1CF8, 0x1CF9, true}, {0x1DC0, 0x1DC1, true},
+    {0x1DC2, 0x1DC2, false}, {0x1DC3, 0x1DC9, true}, {0x1DCA, 0x1DCA, false}, {0x1DCB, 0x1DCC, true},
+    {0x1DCD, 0x1DD0, false}, {0x1DD1, 0x1DF5, true}, {0x1DF6, 0x1DFA, false}, {0x1DFB, 0x1DFB, true},
+    {0x1DFC, 0x1DFD, false}, {0x1DFE, 0x1DFE, true}, {0x1DFF, 0x1DFF, false}, {0x20D0, 0x20D1, true},
+    {0x20D2, 0x20D3, false}, {0x20D4, 0x20D7, true}, {0x20D8, 0x20DA, false}, {0x20DB, 0x20DC, true},
+    {0x20E1, 0x20E1, true}, {0x20E5, 0x20E6, false}, {0x20E7, 0x20E7, true}, {0x20E8, 0x20E8, false},
+    {0x20E9, 0x20E9, true}, {0x20EA, 0x20EF, false}, {0x20F0, 0x20F0, true}, {0x2CEF, 0x2CF1, true},
+    {0x2D7F, 0x2D7F, false}, {0x2DE0, 0x2DFF, true}, {0x302A, 0x302F, false}, {0x3099, 0x309A, false},
+    {0xA66F, 0xA66F, true}, {0xA674, 0xA67D, true}, {0xA69E, 0xA69F, true}, {0xA6F0, 0xA6F1, true},
+    {0xA806, 0xA806, false}, {0xA82C, 0xA82C, false}, {0xA8C4, 0xA8C4, false}, {0xA8E0, 0xA8F1, true},
+    {0xA92B, 0xA92D, false}, {0xA953, 0xA953, false}, {0xA9B3, 0xA9B3, false}, {0xA9C0, 0xA9C0, false},
+    {0xAAB0, 0xAAB0, true}, {0xAAB2, 0xAAB3, true}, {0xAAB4, 0xAAB4, false}, {0xAAB7, 0xAAB8, true},
+    {0xAABE, 0xAABF, true}, {0xAAC1, 0xAAC1, true}, {0xAAF6, 0xAAF6, false}, {0xABED, 0xABED, false},
+    {0xFB1E, 0xFB1E, false}, {0xFE20, 0xFE26, true}, {0xFE27, 0xFE2D, false}, {0xFE2E, 0xFE2F, true},
+    {0x101FD, 0x101FD, false}, {0x102E0, 0x102E0, false}, {0x10376, 0x1037A, true}, {0x10A0D, 0x10A0D, false},
+    {0x10A0F, 0x10A0F, true}, {0x10A38, 0x10A38, true}, {0x10A39, 0x10A3A, false}, {0x10A3F, 0x10A3F, false},
+    {0x10AE5, 0x10AE5, true}, {0x10AE6, 0x10AE6, false}, {0x10D24, 0x10D27, true}, {0x10EAB, 0x10EAC, true},
+    {0x10F46, 0x10F47, false}, {0x10F48, 0x10F4A, true}, {0x10F4B, 0x10F4B, false}, {0x10F4C, 0x10F4C, true},
+    {0x10F4D, 0x10F50, false}, {0x10F82, 0x10F82, true}, {0x10F83, 0x10F83, false}, {0x10F84, 0x10F84, true},
+    {0x10F85, 0x10F85, false}, {0x11046, 0x11046, false}, {0x11070, 0x11070, false}, {0x1107F, 0x1107F, false},
+    {0x110B9, 0x110BA, false}, {0x11100, 0x11102, true}, {0x11133, 0x11134, false}, {0x11173, 0x11173, false},
+    {0x111C0, 0x111C0, false}, {0x111CA, 0x111CA, false}, {0x11235, 0x11236, false}, {0x112E9, 0x112EA, false},
+    {0x1133B, 0x1133C, false}, {0x1134D, 0x1134D, false}, {0x11366, 0x1136C, true}, {0x11370, 0x11374, true},
+    {0x11442, 0x11442, false}, {0x11446, 0x11446, false}, {0x1145E, 0x1145E, true}, {0x114C2, 0x114C3, false},
+    {0x115BF, 0x115C0, false}, {0x1163F, 0x1163F, false}, {0x116B6, 0x116B7, false}, {0x1172B, 0x1172B, false},
+    {0x11839, 0x1183A, false}, {0x1193D, 0x1193E, false}, {0x11943, 0x11943, false}, {0x119E0, 0x119E0, false},
+    {0x11A34, 0x11A34, false}, {0x11A47, 0x11A47, false}, {0x11A99, 0x11A99, false}, {0x11C3F, 0x11C3F, false},
+    {0x11D42, 0x11D42, false}, {0x11D44, 0x11D45, false}, {0x11D97, 0x11D97, false}, {0x16AF0, 0x16AF4, false},
+    {0x16B30, 0x16B36, true}, {0x16FF0, 0x16FF1, false}, {0x1BC9E, 0x1BC9E, false}, {0x1D165, 0x1D169, false},
+    {0x1D16D, 0x1D172, false}, {0x1D17B, 0x1D182, false}, {0x1D185, 0x1D189, true}, {0x1D18A, 0x1D18B, false},
+    {0x1D1AA, 0x1D1AD, true}, {0x1D242, 0x1D244, true}, {0x1E000, 0x1E006, true}, {0x1E008, 0x1E018, true},
+    {0x1E01B, 0x1E021, true}, {0x1E023, 0x1E024, true}, {0x1E026, 0x1E02A, true}, {0x1E130, 0x1E136, true},
+    {0x1E2AE, 0x1E2AE, true}, {0x1E2EC, 0x1E2EF, true}, {0x1E8D0, 0x1E8D6, false}, {0x1E944, 0x1E949, true},
+    {0x1E94A, 0x1E94A, false},
+};
+
+static const uint32_t COMBINING_DOT_ABOVE = 0x0307;
+static const uint32_t CAPITAL_SIGMA = 0x03A3;
+static const uint32_t FINAL_SIGMA = 0x03C2;
+static const uint32_t SMALL_SIGMA = 0x03C3;
+
+// Marks the position of a byte that is not part of a valid UTF-8 sequence.  It is copied unchanged.
+static const uint32_t RAW_BYTE = 0x80000000;
+
+// Letters with the Soft_Dotted property that are likely to appear in Lithuanian text
+static const uint32_t SOFT_DOTTED[] = {
+    0x0069, 0x006A, 0x012F, 0x0249, 0x0268, 0x029D, 0x02B2, 0x03F3, 0x0456, 0x0458, 0x1D62, 0x1D96,
+    0x1DA4, 0x1DA8, 0x1E2D, 0x1ECB, 0x2071, 0x2148, 0x2149, 0x2C7C,
+};
+
+// Punctuation and modifier characters with the Case_Ignorable property.  Combining marks are also case-ignorable.
+static const uint32_t CASE_IGNORABLE[] = {
+    0x0027, 0x002E, 0x003A, 0x005E, 0x0060, 0x00A8, 0x00AD, 0x00AF, 0x00B4, 0x00B7, 0x00B8, 0x2018,
+    0x2019, 0x2024, 0x2027,
+};
+
+enum CaseLanguage {
+    kCaseLanguageDefault,
+    kCaseLanguageTurkic,
+    kCaseLanguageLithuanian
+};
+
+template<size_t N>
+static bool
+contains(const uint32_t (&table)[N], uint32_t codepoint)
+{
+    return std::binary_search(table, table + N, codepoint);
+}
+
+template<size_t N>
+static const CaseRange *
+findRange(const CaseRange (&table)[N], uint32_t codepoint)
+{
+    auto it = std::upper_bound(table, table + N, codepoint,
+                               [](uint32_t cp, const CaseRange& range) { return cp < range.start; });
+    if (it == table)
+        return nullptr;
+
+    const auto& range = *(it - 1);
+    auto offset = codepoint - range.start;
+    if (offset % range.stride != 0 || offset / range.stride >= range.count)
+        return nullptr;
+
+    return &range;
+}
+
+template<size_t N>
+static const char *
+findSpecial(const SpecialCase (&table)[N], uint32_t codepoint)
+{
+    auto it = std::lower_bound(table, table + N, codepoint,
+                               [](const SpecialCase& special, uint32_t cp) { return special.codepoint < cp; });
+    return it != table + N && it->codepoint == codepoint ? it->mapping : nullptr;
+}
+
+/**
+ * @return 0 if the code point is not a combining mark, 1 for a mark above, and 2 for any other mark.
+ */
+static int
+combiningType(uint32_t codepoint)
+{
+    auto end = COMBINING_RANGES + sizeof(COMBINING_RANGES) / sizeof(COMBINING_RANGES[0]);
+    auto it = std::upper_bound(COMBINING_RANGES, end, codepoint,
+                               [](uint32_t cp, const CombiningRange& range) { return cp < range.first; });
+    if (it == COMBINING_RANGES || codepoint > (it - 1)->last)
+        return 0;
+    return (it - 1)->above ? 1 : 2;
+}
+
+static uint32_t
+simpleUpper(uint32_t codepoint)
+{
+    auto range = findRange(UPPER_RANGES, codepoint);
+    return range ? codepoint + range->delta : codepoint;
+}
+
+static uint32_t
+simpleLower(uint32_t codepoint)
+{
+    auto range = findRange(LOWER_RANGES, codepoint);
+    return range ? codepoint + range->delta : codepoint;
+}
+
+static bool
+isCased(uint32_t codepoint)
+{
+    return findRange(UPPER_RANGES, codepoint) || findRange(LOWER_RANGES, codepoint) ||
+           findSpecial(UPPER_SPECIAL, codepoint);
+}
+
+static bool
+isCaseIgnorable(uint32_t codepoint)
+{
+    return combiningType(codepoint) != 0 || contains(CASE_IGNORABLE, codepoint);
+}
+
+static CaseLanguage
+caseLanguage(const std::string& locale)
+{
+    auto language = locale.substr(0, locale.find_first_of("-_"));
+    std::transform(language.begin(), language.end(), language.begin(),
+                   [](unsigned char c) -> unsigned char { return std::tolower(c); });
+
+    if (language == "tr" || language == "az")
+        return kCaseLanguageTurkic;
+    if (language == "lt")
+        return kCaseLanguageLithuanian;
+    return kCaseLanguageDefault;
+}
+
+static bool
+isAscii(const std::string& value)
+{
+    return std::all_of(value.begin(), value.end(), [](char c) { return (c & 0x80) == 0; });
+}
+
+/**
+ * Decode a UTF-8 string.  Bytes that are not part of a well-formed sequence are returned as RAW_BYTE
+ * values so that they can be passed through unchanged.
+ */
+static std::vector<uint32_t>
+decode(const std::string& value)
+{
+    std::vector<uint32_t> result;
+    result.reserve(value.size());
+
+    auto ptr = reinterpret_cast<const uint8_t *>(value.data());
+    auto end = ptr + value.size();
+    while (ptr < end) {
+        uint8_t byte = *ptr;
+        int trailing = byte < 0x80 ? 0 : byte < 0xc2 ? -1 : byte < 0xe0 ? 1 : byte < 0xf0 ? 2 : byte < 0xf5 ? 3 : -1;
+        if (trailing < 0 || end - ptr <= trailing) {
+            result.push_back(RAW_BYTE | *ptr++);
+            continue;
+        }
+
+        uint32_t codepoint = trailing == 0 ? byte : byte & (0x3f >> trailing);
+        bool valid = true;
+        for (int i = 1; i <= trailing && valid; i++) {
+            valid = (ptr[i] & 0xc0) == 0x80;
+            codepoint = (codepoint << 6) | (ptr[i] & 0x3f);
+        }
+
+        // Reject overlong forms, surrogates and values past the end of the code space
+        if (valid && trailing == 2)
+            valid = codepoint >= 0x800 && (codepoint < 0xd800 || codepoint > 0xdfff);
+        if (valid && trailing == 3)
+            valid = codepoint >= 0x10000 && codepoint <= 0x10ffff;
+
+        if (!valid) {
+            result.push_back(RAW_BYTE | *ptr++);
+            continue;
+        }
+
+        result.push_back(codepoint);
+        ptr += trailing + 1;
+    }
+
+    return result;
+}
+
+static void
+append(std::string& out, uint32_t codepoint)
+{
+    if (codepoint & RAW_BYTE) {
+        out.push_back(static_cast<char>(codepoint & 0xff));
+    }
+    else if (codepoint < 0x80) {
+        out.push_back(static_cast<char>(codepoint));
+    }
+    else if (codepoint < 0x800) {
+        out.push_back(static_cast<char>(0xc0 | (codepoint >> 6)));
+        out.push_back(static_cast<char>(0x80 | (codepoint & 0x3f)));
+    }
+    else if (codepoint < 0x10000) {
+        out.push_back(static_cast<char>(0xe0 | (codepoint >> 12)));
+        out.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3f)));
+        out.push_back(static_cast<char>(0x80 | (codepoint & 0x3f)));
+    }
+    else {
+        out.push_back(static_cast<char>(0xf0 | (codepoint >> 18)));
+        out.push_back(static_cast<char>(0x80 | ((codepoint >> 12) & 0x3f)));
+        out.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3f)));
+        out.push_back(static_cast<char>(0x80 | (codepoint & 0x3f)));
+    }
+}
+
+/**
+ * Final_Sigma: the sigma follows a cased letter and is not followed by one, ignoring case-ignorable
+ * characters in both directions.
+ */
+static bool
+isFinalSigma(const std::vector<uint32_t>& text, size_t index)
+{
+    size_t i = index;
+    bool before = false;
+    while (i > 0) {
+        auto cp = text[--i];
+        if (isCaseIgnorable(cp))
+            continue;
+        before = isCased(cp);
+        break;
+    }
+    if (!before)
+        return false;
+
+    for (i = index + 1; i < text.size(); i++) {
+        auto cp = text[i];
+        if (isCaseIgnorable(cp))
+            continue;
+        return !isCased(cp);
+    }
+
+    return true;
+}
+
+/**
+ * More_Above: the character is followed by a combining mark above, with no base character in between.
+ */
+static bool
+isMoreAbove(const std::vector<uint32_t>& text, size_t index)
+{
+    for (size_t i = index + 1; i < text.size(); i++) {
+        auto type = combiningType(text[i]);
+        if (type == 0)
+            return false;
+        if (type == 1)
+            return true;
+    }
+    return false;
+}
+
+/**
+ * Before_Dot: the character is followed by U+0307 COMBINING DOT ABOVE, with only marks that are not
+ * "above" marks in between.
+ */
+static bool
+isBeforeDot(const std::vector<uint32_t>& text, size_t index)
+{
+    for (size_t i = index + 1; i < text.size(); i++) {
+        if (text[i] == COMBINING_DOT_ABOVE)
+            return true;
+        if (combiningType(text[i]) != 2)
+            return false;
+    }
+    return false;
+}
+
+/**
+ * Check if the preceding base character matches a predicate, skipping marks that are not "above" marks.
+ * Used for the After_I and After_Soft_Dotted conditions.
+ */
+template<class Predicate>
+static bool
+isAfter(const std::vector<uint32_t>& text, size_t index, Predicate predicate)
+{
+    size_t i = index;
+    while (i > 0) {
+        auto cp = text[--i];
+        if (combiningType(cp) != 2)
+            return predicate(cp);
+    }
+    return false;
+}
+
+std::string
+utf8ToUpper(const std::string& utf8String, const std::string& locale)
+{
+    auto language = caseLanguage(locale);
+
+    if (isAscii(utf8String) && language != kCaseLanguageTurkic) {
+        std::string result(utf8String);
+        for (auto& c : result)
+            if (c >= 'a' && c <= 'z')
+                c -= 'a' - 'A';
+        return result;
+    }
+
+    auto text = decode(utf8String);
+    std::string result;
+    result.reserve(utf8String.size());
+
+    for (size_t i = 0; i < text.size(); i++) {
+        auto cp = text[i];
+
+        if (language == kCaseLanguageTurkic && cp == 'i') {
+            append(result, 0x0130);
+            continue;
+        }
+
+        // Lithuanian keeps an explicit dot on a lowercase i or j; it is removed when uppercasing
+        if (language == kCaseLanguageLithuanian && cp == COMBINING_DOT_ABOVE &&
+            isAfter(text, i, [](uint32_t c) { return contains(SOFT_DOTTED, c); }))
+            continue;
+
+        if (auto special = findSpecial(UPPER_SPECIAL, cp))
+            result += special;
+        else
+            append(result, simpleUpper(cp));
+    }
+
+    return result;
+}
+
+std::string
+utf8ToLower(const std::string& utf8String, const std::string& locale)
+{
+    auto language = caseLanguage(locale);
+
+    if (isAscii(utf8String) && language != kCaseLanguageTurkic) {
+        std::string result(utf8String);
+        for (auto& c : result)
+            if (c >= 'A' && c <= 'Z')
+                c += 'a' - 'A';
+        return result;
+    }
+
+    auto text = decode(utf8String);
+    std::string result;
+    result.reserve(utf8String.size());
+
+    for (size_t i = 0; i < text.size(); i++) {
+        auto cp = text[i];
+
+        if (language == kCaseLanguageTurkic) {
+            if (cp == 0x0130) {
+                append(result, 'i');
+                continue;
+            }
+            if (cp == 'I') {
+                append(result, isBeforeDot(text, i) ? 'i' : 0x0131);
+                continue;
+            }
+            if (cp == COMBINING_DOT_ABOVE && isAfter(text, i, [](uint32_t c) { return c == 'I'; }))
+                continue;
+        }
+        else if (language == kCaseLanguageLithuanian) {
+            // Keep the dot when an accent is placed over a lowercase i or j
+            if ((cp == 'I' || cp == 'J' || cp == 0x012E) && isMoreAbove(text, i)) {
+                append(result, simpleLower(cp));
+                append(result, COMBINING_DOT_ABOVE);
+                continue;
+            }
+            if (cp == 0x00CC || cp == 0x00CD || cp == 0x0128) {
+                append(result, 'i');
+                append(result, COMBINING_DOT_ABOVE);
+                append(result, cp == 0x00CC ? 0x0300 : cp == 0x00CD ? 0x0301 : 0x0303);
+                continue;
+            }
+        }
+
+        if (cp == CAPITAL_SIGMA) {
+            append(result, isFinalSigma(text, i) ? FINAL_SIGMA : SMALL_SIGMA);
+            continue;
+        }
+
+        if (auto special = findSpecial(LOWER_SPECIAL, cp))
+            result += special;
+        else
+            append(result, simpleLower(cp));
+    }
+
+    return result;
+}
+
+} // namespace apl
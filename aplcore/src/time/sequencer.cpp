@@ -16,6 +16,7 @@
 #include "apl/time/sequencer.h"
 #include "apl/utils/log.h"
 #include "apl/command/arraycommand.h"
+#include "apl/command/commandfactory.h"
 #include "apl/action/delayaction.h"
 #include "apl/time/timemanager.h"
 
@@ -123,6 +124,56 @@ Sequencer::executeFast(const CommandPtr& commandPtr)
     }
 }
 
+/**
+ * Run an array of commands in fast mode starting at startIndex.  This matches the behavior of an
+ * ArrayCommand executed in fast mode, but commands that finish synchronously (SetValue, SetState,
+ * SendEvent, and so forth) run inline without allocating ArrayAction or DelayAction wrappers.
+ * When a command suspends, the remaining commands continue once its action resolves.
+ */
+void
+Sequencer::executeCommandsFast(const Object& commands,
+                               size_t startIndex,
+                               const ContextPtr& context,
+                               const CoreComponentPtr& baseComponent)
+{
+    Properties properties;
+    for (size_t index = startIndex ; index < commands.size() ; index++) {
+        if (mTerminated)
+            return;
+
+        auto commandPtr = CommandFactory::instance().inflate(context, commands.at(index), properties,
+                                                             baseComponent);
+        if (!commandPtr)
+            continue;
+
+        auto childSeq = commandPtr->sequencer();
+        if (!childSeq.empty()) {
+            executeOnSequencer(commandPtr, childSeq);
+            continue;
+        }
+
+        // Fast mode ignores delays, so the command runs immediately
+        commandPtr->prepare();
+        auto action = commandPtr->execute(mTimeManager, true);
+        if (!action || action->isResolved()) {
+            commandPtr->complete();
+            continue;
+        }
+
+        // The command suspended.  Hold the action and pick up the remaining commands when it resolves.
+        mOneShotSet.emplace(action);
+        action->then([this, commandPtr, commands, index, context, baseComponent](const ActionPtr& ptr) {
+            mOneShotSet.erase(ptr);
+            commandPtr->complete();
+            executeCommandsFast(commands, index + 1, context, baseComponent);
+        });
+        action->addTerminateCallback([commandPtr](const TimersPtr&) {
+            commandPtr->complete();
+        });
+        return;
+    }
+}
+
 ActionPtr
 Sequencer::execute(const CommandPtr& commandPtr, bool fastMode)
 {
@@ -161,7 +212,12 @@ Sequencer::executeCommands(const Object& commands,
     if (commands.empty())
         return nullptr;
 
-    if (!context->has("event") && !fastMode)
+    if (fastMode) {
+        executeCommandsFast(commands, 0, context, baseComponent);
+        return nullptr;
+    }
+
+    if (!context->has("event"))
         LOG(LogLevel::kWarn) << "missing event in context";
 
     Properties props;
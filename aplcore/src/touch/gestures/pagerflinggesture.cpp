@@ -152,6 +152,7 @@ PagerFlingGesture::onMove(const PointerEvent& event, apl_time_t timestamp)
 
     auto pager = std::dynamic_pointer_cast<PagerComponent>(mActionable);
     auto localPoint = mActionable->toLocalPoint(event.pointerEventPosition);
+    auto started = false;
     auto distance = getDistance(mActionable, mStartPosition, localPoint);
     // Flip direction for RTL layout
     auto direction = (mActionable->isHorizontal() && mLayoutDirection == kLayoutDirectionRTL)
@@ -187,6 +188,7 @@ PagerFlingGesture::onMove(const PointerEvent& event, apl_time_t timestamp)
         mTargetPage = calculateTargetPage(mActionable, mPageDirection, mCurrentPage);
 
         pager->startPageMove(mPageDirection, mCurrentPage, mTargetPage);
+        started = true;
     }
 
     if (mTriggered) {
@@ -210,12 +212,16 @@ PagerFlingGesture::onMove(const PointerEvent& event, apl_time_t timestamp)
                 mCurrentPage = mTargetPage;
                 mTargetPage = calculateTargetPage(mActionable, mPageDirection, mCurrentPage);
                 pager->startPageMove(mPageDirection, mCurrentPage, mTargetPage);
+                started = true;
             } else {
                 reset();
             }
         }
         mLastAnimationAmount = mAmount;
         pager->executePageMove(mAmount);
+        // Host composited moves follow the pointer on the viewhost, only a new move is published
+        if (started)
+            pager->publishPageTransition(kPageTransitionPhaseDrag, mAmount, mAmount, 0);
     }
 
     return true;
@@ -226,21 +232,27 @@ PagerFlingGesture::animateRemainder(bool fulfill)
 {
     auto duration = mActionable->getRootConfig().getDefaultPagerAnimationDuration();
     auto remainder = fulfill ? 1.0f - mAmount : -mAmount;
+    auto pager = std::dynamic_pointer_cast<PagerComponent>(mActionable);
 
     std::weak_ptr<PagerFlingGesture> weak_ptr(std::static_pointer_cast<PagerFlingGesture>(shared_from_this()));
-    mAnimateAction = Action::makeAnimation(mActionable->getRootConfig().getTimeManager(), duration,
-       [weak_ptr, duration, remainder](apl_duration_t offset) {
-           auto self = weak_ptr.lock();
-           if (self) {
-               float alpha = offset/duration;
-               // Float numbers could be flaky. Limit it to extremes
-               alpha = std::max(0.0f, std::min(1.0f, alpha));
-
-               auto amount = self->mAmount + alpha * remainder;
-               self->mLastAnimationAmount = amount;
-               std::dynamic_pointer_cast<PagerComponent>(self->mActionable)->executePageMove(amount);
-           }
-       });
+    if (pager->publishPageTransition(kPageTransitionPhaseSettle, mAmount, fulfill ? 1.0f : 0.0f, duration)) {
+        // The viewhost animates the remainder, wait for it to finish
+        mAnimateAction = Action::makeDelayed(mActionable->getRootConfig().getTimeManager(), duration);
+    } else {
+        mAnimateAction = Action::makeAnimation(mActionable->getRootConfig().getTimeManager(), duration,
+           [weak_ptr, duration, remainder](apl_duration_t offset) {
+               auto self = weak_ptr.lock();
+               if (self) {
+                   float alpha = offset/duration;
+                   // Float numbers could be flaky. Limit it to extremes
+                   alpha = std::max(0.0f, std::min(1.0f, alpha));
+
+                   auto amount = self->mAmount + alpha * remainder;
+                   self->mLastAnimationAmount = amount;
+                   std::dynamic_pointer_cast<PagerComponent>(self->mActionable)->executePageMove(amount);
+               }
+           });
+    }
 
     if (mAnimateAction && mAnimateAction->isPending()) {
         mAnimateAction->then([weak_ptr, fulfill](const ActionPtr& actionPtr){
@@ -51,6 +51,24 @@ AutoScroller::AutoScroller(const ScrollablePtr& scrollable, FinishFunc finish) :
     mStartTime(scrollable->getRootConfig().getTimeManager()->currentTime())
 {}
 
+AutoScroller::~AutoScroller()
+{
+    // Abandoned before finishing, let the component catch up on what it deferred.
+    if (!mFinished) {
+        if (auto scrollable = mScrollable.lock())
+            scrollable->clearScrollProjection();
+    }
+}
+
+void
+AutoScroller::finish()
+{
+    mFinished = true;
+    if (auto scrollable = mScrollable.lock())
+        scrollable->clearScrollProjection();
+    mOnFinish();
+}
+
 void
 AutoScroller::update(apl_time_t time)
 {
@@ -39,6 +39,12 @@ static const Bimap<PageMoveDrawOrder, std::string> sPageMoveDrawOrderBimap = {
     {kPageMoveDrawOrderHigherBelow, "higher-below"},
 };
 
+static const Bimap<PageTransitionPhase, std::string> sPageTransitionPhaseBimap = {
+    {kPageTransitionPhaseDrag,    "drag"},
+    {kPageTransitionPhaseSettle,  "settle"},
+    {kPageTransitionPhaseAnimate, "animate"},
+};
+
 std::unique_ptr<PageMoveHandler>
 PageMoveHandler::create(
     const CoreComponentPtr& component,
@@ -80,6 +86,15 @@ PageMoveHandler::create(
         fromLeft = !fromLeft;
     }
 
+    // Host composited transitions leave the per-frame transforms to the viewhost
+    if (component->getRootConfig().experimentalFeatureEnabled(RootConfig::kExperimentalFeatureHostPageTransitions)) {
+        auto handler = std::make_unique<PageMoveHandler>(swipeDirection, pageDirection, currentChild,
+            nextChild, nullptr, nullptr);
+        handler->mTransition = describeTransition(pager, swipeDirection, pageDirection, currentChild, nextChild, fromLeft);
+        handler->reset();
+        return handler;
+    }
+
     auto currentChildTransform = getPageTransformation(pager, false, fromLeft);
     auto targetChildTransform = getPageTransformation(pager, true, fromLeft);
     auto handler = std::make_unique<PageMoveHandler>(swipeDirection, pageDirection, currentChild,
@@ -145,14 +160,33 @@ PageMoveHandler::execute(const CoreComponentPtr& component, float amount)
     }
 
     if (mCommands.isNull()) {
+        // The viewhost drives the frames of the published transition phase
+        if (mTransition)
+            return;
+
         auto animationEasing = component->getRootConfig().getProperty(RootProperty::kDefaultPagerAnimationEasing).getEasing();
         executeDefaultPagingAnimation(animationEasing->calc(amount), currentPage, targetPage);
-    } else {
+    } else if (!mCommands.empty()) {
         component->getContext()->sequencer().executeCommands(mCommands,
             createPageMoveContext(amount, mSwipeDirection, mPageDirection, component, currentPage, targetPage), component, true);
     }
 }
 
+Object
+PageMoveHandler::getTransition(PageTransitionPhase phase, float startAmount, float endAmount,
+                               apl_duration_t duration) const
+{
+    if (!mTransition)
+        return Object::NULL_OBJECT();
+
+    auto transition = std::make_shared<ObjectMap>(*mTransition);
+    transition->emplace("phase", sPageTransitionPhaseBimap.at(phase));
+    transition->emplace("startAmount", startAmount);
+    transition->emplace("endAmount", endAmount);
+    transition->emplace("duration", duration);
+    return transition;
+}
+
 int
 PageMoveHandler::getTargetPageIndex(const CoreComponentPtr& component) const {
     if (auto targetPage = mTargetPage.lock()) {
@@ -202,25 +236,60 @@ PageMoveHandler::executeDefaultPagingAnimation(
     }
 }
 
+std::pair<float, float>
+PageMoveHandler::getPageShift(const PagerPtr& pager, bool comeIn, bool fromLeft)
+{
+    auto bounds = pager->getCalculated(kPropertyInnerBounds).getRect();
+    auto shift = pager->isHorizontal() ? bounds.getWidth() : bounds.getHeight();
+
+    if (comeIn)
+        return { fromLeft ? shift : -shift, 0 };
+    return { 0, fromLeft ? -shift : shift };
+}
+
 std::shared_ptr<InterpolatedTransformation>
 PageMoveHandler::getPageTransformation(const PagerPtr& pager, bool comeIn, bool fromLeft)
 {
-    auto bounds = pager->getCalculated(kPropertyInnerBounds).getRect();
+    auto shift = getPageShift(pager, comeIn, fromLeft);
+    auto targetTranslate = pager->isHorizontal() ? "translateX" : "translateY";
+
     auto from = std::make_shared<ObjectMap>();
     auto to = std::make_shared<ObjectMap>();
+    from->emplace(targetTranslate, Object(shift.first));
+    to->emplace(targetTranslate, Object(shift.second));
+
+    return InterpolatedTransformation::create(*pager->getContext(), {from}, {to});
+}
 
+ObjectMapPtr
+PageMoveHandler::describeTransition(const PagerPtr& pager, SwipeDirection swipeDirection, PageDirection pageDirection,
+                                  const CoreComponentPtr& currentChild, const CoreComponentPtr& nextChild,
+                                  bool fromLeft)
+{
     auto targetTranslate = pager->isHorizontal() ? "translateX" : "translateY";
-    auto startShift = pager->isHorizontal() ? bounds.getWidth() : bounds.getHeight();
-
-    if (comeIn) {
-        from->emplace(targetTranslate, Object(fromLeft ? startShift : -startShift));
-        to->emplace(targetTranslate, Object(0));
-    } else {
-        from->emplace(targetTranslate, Object(0));
-        to->emplace(targetTranslate, Object(fromLeft ? -startShift : startShift));
-    }
+    auto createChild = [&](const CoreComponentPtr& child, bool comeIn) {
+        auto shift = getPageShift(pager, comeIn, fromLeft);
 
-    return InterpolatedTransformation::create(*pager->getContext(), {from}, {to});
+        auto from = std::make_shared<ObjectMap>();
+        from->emplace(targetTranslate, shift.first);
+        auto to = std::make_shared<ObjectMap>();
+        to->emplace(targetTranslate, shift.second);
+
+        auto result = std::make_shared<ObjectMap>();
+        result->emplace("id", child->getId());
+        result->emplace("uid", child->getUniqueId());
+        result->emplace("from", ObjectArray{from});
+        result->emplace("to", ObjectArray{to});
+        return result;
+    };
+
+    auto transition = std::make_shared<ObjectMap>();
+    transition->emplace("direction", sSwipeDirectionMap.at(swipeDirection));
+    transition->emplace("forward", pageDirection == kPageDirectionForward);
+    transition->emplace("easing", pager->getRootConfig().getProperty(RootProperty::kDefaultPagerAnimationEasing));
+    transition->emplace("currentChild", createChild(currentChild, false));
+    transition->emplace("nextChild", createChild(nextChild, true));
+    return transition;
 }
 
 } // namespace apl
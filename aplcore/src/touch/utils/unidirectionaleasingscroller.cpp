@@ -52,8 +52,12 @@ UnidirectionalEasingScroller::make(
     auto easing = rootConfig.getProperty(RootProperty::kUEScrollerVelocityEasing).getEasing();
     auto maxDuration = rootConfig.getProperty(RootProperty::kUEScrollerMaxDuration).getDouble();
     auto duration = std::min(static_cast<apl_duration_t>(std::abs(distance/directionalVelocity)), maxDuration);
-    return std::make_shared<UnidirectionalEasingScroller>(
+    auto scroller = std::make_shared<UnidirectionalEasingScroller>(
             scrollable, easing, std::move(finish), Point(distance, distance), duration);
+    // Only a fling may defer the work for the children it passes over. Programmatic scrolls, like
+    // the scroll commands, keep loading the children on the way.
+    scroller->mProjectDestination = true;
+    return scroller;
 }
 
 std::shared_ptr<UnidirectionalEasingScroller>
@@ -79,7 +83,9 @@ UnidirectionalEasingScroller::UnidirectionalEasingScroller(
           mScrollStartPosition(scrollable->scrollPosition()),
           mLastScrollPosition(scrollable->scrollPosition()),
           mEndTarget(target),
-          mDuration(duration)
+          mDestination(scrollable->scrollPosition() + target),
+          mDuration(duration),
+          mLastOffset(0)
 {
     LOG_IF(DEBUG_SCROLLER)
         << "StartPos: " << mScrollStartPosition.toString()
@@ -98,7 +104,9 @@ UnidirectionalEasingScroller::update(
 
     // May have got more items in the interim, or as a result of scroll position update
     fixFlingStartPosition(scrollable);
-    auto availablePosition = scrollable->trimScroll(mScrollStartPosition + end);
+    // A fling only lays out the children it actually reaches, so that an interrupted fling does not lay out
+    // everything up to its projected end. Other scrolls find out how far they can go up front.
+    auto availablePosition = scrollable->trimScroll(mScrollStartPosition + (mProjectDestination ? delta : end));
 
     // This could lead to more loading, so fix fling and re-adjust
     fixFlingStartPosition(scrollable);
@@ -123,16 +131,31 @@ UnidirectionalEasingScroller::update(
     }
 
     // Set it to what we expect it to be, because it may move afterwards
-    mLastScrollPosition = vertical ? Point(0, resultingPosition) : Point(resultingPosition, 0);
+    auto resultingPoint = vertical ? Point(0, resultingPosition) : Point(resultingPosition, 0);
+    if (offset > mLastOffset) {
+        auto distance = resultingPoint - mLastScrollPosition;
+        auto elapsed = static_cast<float>(offset - mLastOffset);
+        mVelocity = Point(distance.getX() / elapsed, distance.getY() / elapsed);
+    }
+    mLastOffset = offset;
+    mLastScrollPosition = resultingPoint;
+    mDestination = mProjectDestination ? endTargetPoint : availablePosition;
+
+    if (mProjectDestination)
+        scrollable->setScrollProjection(mDestination);
     scrollable->update(UpdateType::kUpdateScrollPosition, resultingPosition);
 
     // TODO: If update will bring us over maximum position we should switch to "overscroll" instead
     //  of stopping. It's not default behavior though. Can be resolved with "Overscroller" mixin?.
     if (offset <= 0)
         return;
+    // A fling trims to the current target, so it reached the end of the content only if that was cut short
+    auto reachedEnd = (horizontal && isRTL)
+                          ? (mProjectDestination ? availableTarget > target : availableTarget >= target)
+                          : (mProjectDestination ? availableTarget < target : availableTarget <= target);
     bool isFinished = (horizontal && isRTL)
-                          ? (target >= 0 || (endTarget < target && availableTarget >= target) || offset == mDuration)
-                          : (target <= 0 || (endTarget > target && availableTarget <= target) || offset == mDuration);
+                          ? (target >= 0 || (endTarget < target && reachedEnd) || offset == mDuration)
+                          : (target <= 0 || (endTarget > target && reachedEnd) || offset == mDuration);
     if (isFinished) {
        finish();
     }
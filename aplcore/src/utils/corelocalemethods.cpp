@@ -16,30 +16,38 @@
 #include <algorithm>
 
 #include "apl/utils/corelocalemethods.h"
+#include "apl/primitives/unicode.h"
 
 namespace apl {
 
+/**
+ * Convert a string, using the cache for anything that is not plain ASCII.  ASCII conversion is
+ * cheaper than a cache lookup.
+ */
+static std::string
+convert(LruCache<std::string, std::string>& cache, const std::string& value, const std::string& locale,
+        std::string (*func)(const std::string&, const std::string&))
+{
+    if (std::all_of(value.begin(), value.end(), [](char c) { return (c & 0x80) == 0; }))
+        return func(value, locale);
+
+    auto key = locale + '\0' + value;
+    if (cache.has(key))
+        return cache.get(key);
+
+    auto result = func(value, locale);
+    cache.put(key, result);
+    return result;
+}
+
 std::string
 CoreLocaleMethods::toUpperCase(const std::string& value, const std::string& locale) {
-    std::string result;
-    result.resize(value.size());
-
-    std::transform(value.begin(), value.end(), result.begin(),
-                            [](unsigned char c) -> unsigned char { return std::toupper(c); });
-
-    return result;
+    return convert(mUpperCache, value, locale, utf8ToUpper);
 }
 
 std::string
 CoreLocaleMethods::toLowerCase(const std::string& value, const std::string& locale) {
-    std::string result;
-    result.resize(value.size());
-
-    std::transform(value.begin(), value.end(), result.begin(),
-                            [](unsigned char c) -> unsigned char { return std::tolower(c); });
-
-    return result;
+    return convert(mLowerCache, value, locale, utf8ToLower);
 }
 
 } // namespace apl
-
@@ -57,6 +57,8 @@ public_apl_headers=(
     "apl/engine/dependant.h"
     "apl/engine/event.h"
     "apl/engine/info.h"
+    "apl/engine/inputrecorder.h"
+    "apl/engine/inputreplayer.h"
     "apl/engine/jsonresource.h"
     "apl/engine/parameterarray.h"
     "apl/engine/properties.h"
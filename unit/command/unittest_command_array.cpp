@@ -49,13 +49,65 @@ public:
 
 int TestCommand::sSum;
 
+class SyncTestCommand : public Command {
+public:
+    static CommandPtr create(const ContextPtr& context,
+                             Properties&& props,
+                             const CoreComponentPtr& base,
+                             const std::string& parentSequencer = "") {
+        auto value = props.asNumber(*context, "argument", -1);
+        return std::make_shared<SyncTestCommand>(value);
+    }
+
+    SyncTestCommand(int value) : mValue(value) {}
+
+    unsigned long delay() const override { return 1000; }
+    std::string name() const override { return "SyncTest"; }
+    ActionPtr execute(const TimersPtr& timers, bool fastMode) override {
+        TestCommand::sSum += mValue;
+        return nullptr;
+    }
+    void complete() override { sCompleted++; }
+
+    int mValue;
+    static int sCompleted;
+};
+
+int SyncTestCommand::sCompleted;
+
+class SuspendTestCommand : public Command {
+public:
+    static CommandPtr create(const ContextPtr& context,
+                             Properties&& props,
+                             const CoreComponentPtr& base,
+                             const std::string& parentSequencer = "") {
+        auto value = props.asNumber(*context, "argument", -1);
+        return std::make_shared<SuspendTestCommand>(value);
+    }
+
+    SuspendTestCommand(int value) : mValue(value) {}
+
+    unsigned long delay() const override { return 1000; }
+    std::string name() const override { return "SuspendTest"; }
+    ActionPtr execute(const TimersPtr& timers, bool fastMode) override {
+        TestCommand::sSum += mValue;
+        return Action::makeDelayed(timers, 100);
+    }
+    std::string sequencer() const override { return ""; }
+
+    int mValue;
+};
+
 class ArrayCommandTest : public ActionWrapper {
 public:
     ArrayCommandTest()
         : ActionWrapper()
     {
         CommandFactory::instance().set("Test", TestCommand::create);
+        CommandFactory::instance().set("SyncTest", SyncTestCommand::create);
+        CommandFactory::instance().set("SuspendTest", SuspendTestCommand::create);
         TestCommand::sSum = 0;
+        SyncTestCommand::sCompleted = 0;
 
         context = Context::createTestContext(Metrics(), RootConfig().timeManager(loop));
     }
@@ -251,3 +303,88 @@ TEST_F(ArrayCommandTest, SequencerFastMode)
     ASSERT_EQ(0, loop->size());
     ASSERT_EQ(7, TestCommand::sSum);
 }
+
+TEST_F(ArrayCommandTest, SequencerExecuteCommandsFastMode)
+{
+    auto json = JsonData(BASIC);
+    auto action = context->sequencer().executeCommands(json.get(), context, nullptr, true);
+
+    // Each command resolves immediately, so they all run inline
+    ASSERT_FALSE(action);
+    ASSERT_EQ(0, loop->size());
+    ASSERT_EQ(7, TestCommand::sSum);
+}
+
+static const char *SYNCHRONOUS = R"(
+[
+  {
+    "type": "SyncTest",
+    "argument": 1
+  },
+  {
+    "type": "SyncTest",
+    "argument": 2,
+    "when": false
+  },
+  {
+    "type": "SyncTest",
+    "argument": 4
+  }
+]
+)";
+
+TEST_F(ArrayCommandTest, SequencerExecuteCommandsSynchronous)
+{
+    auto json = JsonData(SYNCHRONOUS);
+
+#ifdef DEBUG_MEMORY_USE
+    auto actionsBefore = Counter<Action>::itemsDelta();
+#endif
+
+    auto action = context->sequencer().executeCommands(json.get(), context, nullptr, true);
+
+    // Everything ran inline without scheduling any work
+    ASSERT_FALSE(action);
+    ASSERT_EQ(0, loop->size());
+    ASSERT_EQ(5, TestCommand::sSum);
+    ASSERT_EQ(2, SyncTestCommand::sCompleted);
+
+#ifdef DEBUG_MEMORY_USE
+    // No action objects were created for synchronous commands
+    ASSERT_EQ(actionsBefore.created, Counter<Action>::itemsDelta().created);
+#endif
+}
+
+TEST_F(ArrayCommandTest, SequencerExecuteCommandsMixed)
+{
+    auto json = JsonData(R"([
+      { "type": "SyncTest", "argument": 1 },
+      { "type": "SuspendTest", "argument": 10 },
+      { "type": "SyncTest", "argument": 100 }
+    ])");
+
+    context->sequencer().executeCommands(json.get(), context, nullptr, true);
+    ASSERT_EQ(11, TestCommand::sSum);   // Stopped at the suspended command
+    ASSERT_EQ(1, SyncTestCommand::sCompleted);
+
+    loop->advanceToEnd();
+    ASSERT_EQ(111, TestCommand::sSum);
+    ASSERT_EQ(2, SyncTestCommand::sCompleted);
+}
+
+TEST_F(ArrayCommandTest, SequencerExecuteCommandsTerminated)
+{
+    auto json = JsonData(R"([
+      { "type": "SuspendTest", "argument": 10 },
+      { "type": "SyncTest", "argument": 100 }
+    ])");
+
+    context->sequencer().executeCommands(json.get(), context, nullptr, true);
+    ASSERT_EQ(10, TestCommand::sSum);
+
+    // Terminating the sequencer drops the commands that have not started
+    context->sequencer().terminate();
+    loop->advanceToEnd();
+    ASSERT_EQ(10, TestCommand::sSum);
+    ASSERT_EQ(0, SyncTestCommand::sCompleted);
+}
@@ -234,6 +234,45 @@ TEST_F(ComponentEventsTest, ComponentScrolled)
     ASSERT_EQ("Two", text->getCalculated(kPropertyText).asString());
 }
 
+static const char *COMPONENT_SCROLLED_NO_HANDLER = R"(
+        {
+           "type": "APL",
+           "version": "1.0",
+           "mainTemplate": {
+             "items": {
+               "type": "ScrollView",
+               "height": 10,
+               "item": {
+                 "type": "Text",
+                 "height": 50,
+                 "id": "textComp",
+                 "text": "One"
+               }
+             }
+           }
+        }"
+)";
+
+TEST_F(ComponentEventsTest, ComponentScrolledNoHandler)
+{
+    loadDocument(COMPONENT_SCROLLED_NO_HANDLER, DATA);
+    ASSERT_TRUE(component);
+
+#ifdef DEBUG_MEMORY_USE
+    auto contextsBefore = Counter<Context>::itemsDelta();
+#endif
+
+    component->update(kUpdateScrollPosition, 10);
+    ASSERT_EQ(Point(0, 10), component->scrollPosition());
+    loop->advanceToEnd();
+    ASSERT_TRUE(CheckDirty(component, kPropertyNotifyChildrenChanged, kPropertyScrollPosition));
+
+#ifdef DEBUG_MEMORY_USE
+    // Without an onScroll handler there is no event context to build
+    ASSERT_EQ(contextsBefore.created, Counter<Context>::itemsDelta().created);
+#endif
+}
+
 static const char *PAGER_CHANGED = R"(
         {
            "type": "APL",
@@ -16,6 +16,7 @@
 #include "../testeventloop.h"
 #include "apl/component/edittextcomponent.h"
 #include "apl/engine/event.h"
+#include "apl/primitives/characterrange.h"
 #include "apl/primitives/object.h"
 
 using namespace apl;
@@ -441,6 +442,63 @@ TEST_F(EditTextComponentTest, AmountCharacterRanges) {
     ASSERT_FALSE(pEditText->isCharacterValid(L'\u2192'));
 }
 
+static const char* BULK_CHARACTER_RANGES_DOC = u8R"({
+  "type": "APL",
+  "version": "1.4",
+  "mainTemplate": {
+    "item": {
+      "type": "Container",
+      "items": [
+        {
+          "type": "EditText",
+          "validCharacters": "a-fc-kA-Z\u2192-\u2195"
+        },
+        {
+          "type": "EditText",
+          "validCharacters": "a-fc-kA-Z\u2192-\u2195"
+        }
+      ]
+    }
+  }
+})";
+
+/**
+ * Test the whole string methods, overlapping ranges and non-ASCII characters
+ */
+TEST_F(EditTextComponentTest, BulkCharacterRanges) {
+
+    loadDocument(BULK_CHARACTER_RANGES_DOC);
+    auto first = component->getChildAt(0);
+    auto second = component->getChildAt(1);
+
+    ASSERT_TRUE(first->isCharacterValid(L'a'));
+    ASSERT_TRUE(first->isCharacterValid(L'k'));
+    ASSERT_FALSE(first->isCharacterValid(L'l'));
+    ASSERT_TRUE(first->isCharacterValid(L'\u2193'));
+    ASSERT_FALSE(first->isCharacterValid(L'\u2196'));
+
+    ASSERT_TRUE(first->isTextValid(u8"backHAND\u2192"));
+    ASSERT_TRUE(first->isTextValid(""));
+    ASSERT_FALSE(first->isTextValid(u8"back hand"));
+    ASSERT_FALSE(first->isTextValid("bad\xc3"));  // Truncated sequence
+
+    ASSERT_EQ(u8"backHAND\u2192", first->filterText(u8"back HAND 12\u2192\u2196"));
+    ASSERT_EQ("abc", first->filterText("a\xff" "b\xc3\x28" "c"));
+
+    // Overlong forms, surrogates and code points past U+10FFFF are not decoded
+    ASSERT_FALSE(first->isTextValid("\xe0\x81\xa1"));  // Overlong 'a'
+    ASSERT_FALSE(first->isTextValid("\xf0\x82\x86\x92"));  // Overlong U+2192
+    ASSERT_FALSE(first->isTextValid("\xed\xa0\x80"));  // U+D800
+    ASSERT_FALSE(first->isTextValid("\xf4\x90\x80\x80"));  // U+110000
+    ASSERT_EQ("ab", first->filterText("a\xe0\x81\xa1" "b\xed\xa0\x80"));
+    ASSERT_TRUE(first->isTextValid("\xe2\x86\x92"));  // U+2192
+
+    // Identical expressions share one compiled table
+    ASSERT_EQ(second->filterText(u8"back HAND 12\u2192\u2196"), first->filterText(u8"back HAND 12\u2192\u2196"));
+    ASSERT_EQ(CharacterRanges::create(session, u8"a-fc-kA-Z\u2192-\u2195"),
+              CharacterRanges::create(session, u8"a-fc-kA-Z\u2192-\u2195"));
+}
+
 static const char* EMAIL_CHARACTER_RANGES_DOC = R"({
   "type": "APL",
   "version": "1.4",
@@ -111,4 +111,43 @@ TEST_F(OptimizeTest, DeadCodeRemoval)
 
     context->userUpdateAndRecalculate("a", 23, false);
     ASSERT_TRUE(IsEqual(10, result.eval()));
-}
\ No newline at end of file
+}
+
+static std::vector<std::pair<std::string, double>> CLOCK_GRANULARITY = {
+    {"${localTime}", 1},
+    {"${localTime + 1000}", 1},
+    {"${Time.minutes(localTime)}", 60000},
+    {"${Time.seconds(localTime)}", 1000},
+    {"${Time.hours(localTime)}:${Time.minutes(localTime)}", 60000},
+    {"${Time.year(localTime)}", 86400000},
+    {"${Time.milliseconds(localTime)}", 1},
+    {"${Time.format('HH:mm', localTime)}", 60000},
+    {"${Time.format('HH:mm:ss', localTime)}", 1000},
+    {"${Time.format('ss.SS', localTime)}", 10},
+    {"${Time.format('DD/MM/YYYY', localTime)}", 86400000},
+    {"It is ${Time.format('h', localTime)} o'clock", 3600000},
+    {"${Math.floor(localTime / 500)}", 500},
+    {"${Math.floor(localTime / 2.5)}", 1},
+    {"${Math.ceil(localTime / 500)}", 1},
+    {"${Time.minutes(localTime) + Time.seconds(localTime)}", 1000},
+    {"${Time.minutes(localTime) + localTime}", 1},
+    {"${Time.format(a, localTime)}", 1},
+    {"${Time.minutes(a ? localTime : 0)}", 1},
+    {"${a}", 0},
+};
+
+TEST_F(OptimizeTest, ClockGranularity)
+{
+    context->putSystemWriteable("localTime", 0);
+    context->putUserWriteable("a", "HH:mm");
+
+    for (const auto& m : CLOCK_GRANULARITY) {
+        auto result = parseDataBinding(*context, m.first);
+        ASSERT_TRUE(result.isEvaluable()) << m.first;
+
+        // Collecting the symbols optimizes the byte code, which is required for the granularity analysis
+        SymbolReferenceMap symbols;
+        result.symbols(symbols);
+        ASSERT_EQ(m.second, result.getByteCode()->clockGranularity("localTime")) << m.first;
+    }
+}
@@ -1972,6 +1972,77 @@ TEST_F(DynamicIndexListTest, CrudMultiInsert) {
     ASSERT_TRUE(CheckBounds(-5, 11));
 }
 
+static const char *NET_EFFECT_CRUD = R"({
+  "presentationToken": "presentationToken",
+  "listId": "vQdpOESlok",
+  "listVersion": 1,
+  "operations": [
+    { "type": "InsertItem", "index": 10, "item": 100 },
+    { "type": "InsertItem", "index": 11, "item": 101 },
+    { "type": "InsertItem", "index": 12, "item": 102 },
+    { "type": "SetItem", "index": 10, "item": 200 },
+    { "type": "SetItem", "index": 10, "item": 201 },
+    { "type": "InsertItem", "index": 13, "item": 103 },
+    { "type": "DeleteItem", "index": 13 },
+    { "type": "DeleteItem", "index": 11 },
+    { "type": "DeleteItem", "index": 11 }
+  ]
+})";
+
+static const char *NET_EFFECT_MALFORMED_CRUD = R"({
+  "presentationToken": "presentationToken",
+  "listId": "vQdpOESlok",
+  "listVersion": 2,
+  "operations": [
+    { "type": "InsertItem", "index": 11, "item": 111 },
+    { "type": "InsertItem", "index": 12, "item": 112 },
+    { "type": "InsertItem", "item": 113 }
+  ]
+})";
+
+TEST_F(DynamicIndexListTest, CrudNetEffect)
+{
+    loadDocument(BASIC, RESTRICTED_DATA);
+
+    ASSERT_EQ(5, component->getChildCount());
+    ASSERT_TRUE(CheckChildren({10, 11, 12, 13, 14}));
+    ASSERT_TRUE(CheckBounds(10, 15));
+
+    ASSERT_TRUE(ds->processUpdate(NET_EFFECT_CRUD));
+    root->clearPending();
+    ASSERT_TRUE(CheckChildren({201, 10, 11, 12, 13, 14}));
+    ASSERT_TRUE(CheckBounds(10, 16));
+
+    // Operations before the malformed one are applied before the error is reported
+    ASSERT_FALSE(ds->processUpdate(NET_EFFECT_MALFORMED_CRUD));
+    ASSERT_TRUE(CheckErrors({ "INVALID_OPERATION" }));
+    root->clearPending();
+    ASSERT_TRUE(CheckChildren({201, 111, 112, 10, 11, 12, 13, 14}));
+    ASSERT_TRUE(CheckBounds(10, 18));
+}
+
+static const char *NET_EFFECT_OUT_OF_RANGE_CRUD = R"({
+  "presentationToken": "presentationToken",
+  "listId": "vQdpOESlok",
+  "listVersion": 1,
+  "operations": [
+    { "type": "DeleteItem", "index": 14 },
+    { "type": "DeleteItem", "index": 14 }
+  ]
+})";
+
+TEST_F(DynamicIndexListTest, CrudNetEffectOutOfRange)
+{
+    loadDocument(BASIC, RESTRICTED_DATA);
+
+    // Removals past the loaded range fall back to per operation processing and fail on the first invalid one
+    ASSERT_FALSE(ds->processUpdate(NET_EFFECT_OUT_OF_RANGE_CRUD));
+    ASSERT_TRUE(CheckErrors({ "LIST_INDEX_OUT_OF_RANGE" }));
+    root->clearPending();
+    ASSERT_TRUE(CheckChildren({10, 11, 12, 13}));
+    ASSERT_TRUE(CheckBounds(10, 14));
+}
+
 TEST_F(DynamicIndexListTest, CrudMultiInsertAbove) {
     loadDocument(BASIC, STARTING_BOUNDS_DATA);
     ASSERT_EQ(kComponentTypeSequence, component->getType());
@@ -581,4 +581,103 @@ TEST_F(CurrentTimeTest, Terminated){
     ASSERT_TRUE(loop->isTerminated());
     root->updateTime(6464);
     ASSERT_EQ(1000, loop->currentTime());
-}
\ No newline at end of file
+}
+
+static const char *TIME_QUANTIZED =
+    "{"
+    "  \"type\": \"APL\","
+    "  \"version\": \"1.1\","
+    "  \"mainTemplate\": {"
+    "    \"items\": {"
+    "      \"type\": \"Container\","
+    "      \"items\": ["
+    "        {"
+    "          \"type\": \"Text\","
+    "          \"text\": \"${Time.format('HH:mm', localTime)}\""
+    "        },"
+    "        {"
+    "          \"type\": \"Text\","
+    "          \"text\": \"${Math.floor(elapsedTime / 1000)}\""
+    "        }"
+    "      ]"
+    "    }"
+    "  }"
+    "}";
+
+/**
+ * Clock bindings that only observe a coarse boundary are not recalculated until that boundary is crossed
+ */
+TEST_F(CurrentTimeTest, Quantized)
+{
+    // Thu Sep 05 2019 12:15:30  (UTCTime)
+    const apl_time_t START_TIME = 1567685730000;
+    config->utcTime(START_TIME);
+
+    loadDocument(TIME_QUANTIZED);
+    ASSERT_TRUE(component);
+    auto minutes = component->getChildAt(0);
+    auto seconds = component->getChildAt(1);
+
+    ASSERT_TRUE(IsEqual("12:15", minutes->getCalculated(kPropertyText).asString()));
+    ASSERT_TRUE(IsEqual("0", seconds->getCalculated(kPropertyText).asString()));
+
+    // The next boundary is the elapsed time crossing one second
+    ASSERT_EQ(1000, root->nextTime());
+
+    // Advancing within a second changes nothing
+    root->updateTime(500);
+    ASSERT_TRUE(CheckDirty(root));
+    ASSERT_EQ(1000, root->nextTime());
+
+    root->updateTime(1000);
+    ASSERT_TRUE(IsEqual("12:15", minutes->getCalculated(kPropertyText).asString()));
+    ASSERT_TRUE(IsEqual("1", seconds->getCalculated(kPropertyText).asString()));
+    ASSERT_TRUE(CheckDirty(seconds, kPropertyText, kPropertyVisualHash));
+    ASSERT_TRUE(CheckDirty(root, seconds));
+
+    // Cross the minute boundary in local time
+    root->updateTime(30000);
+    ASSERT_TRUE(IsEqual("12:16", minutes->getCalculated(kPropertyText).asString()));
+    ASSERT_TRUE(IsEqual("30", seconds->getCalculated(kPropertyText).asString()));
+    ASSERT_TRUE(CheckDirty(minutes, kPropertyText, kPropertyVisualHash));
+    ASSERT_TRUE(CheckDirty(seconds, kPropertyText, kPropertyVisualHash));
+    ASSERT_TRUE(CheckDirty(root, minutes, seconds));
+}
+
+static const char *TIME_MINUTES_ONLY =
+    "{"
+    "  \"type\": \"APL\","
+    "  \"version\": \"1.1\","
+    "  \"mainTemplate\": {"
+    "    \"items\": {"
+    "      \"type\": \"Text\","
+    "      \"text\": \"${Time.minutes(localTime)}\""
+    "    }"
+    "  }"
+    "}";
+
+/**
+ * With only a minute-level clock binding, the host may sleep until the next minute
+ */
+TEST_F(CurrentTimeTest, NextTimeMinuteBoundary)
+{
+    // Thu Sep 05 2019 12:15:39.476  (UTCTime)
+    const apl_time_t START_TIME = 1567685739476;
+    config->utcTime(START_TIME);
+
+    loadDocument(TIME_MINUTES_ONLY);
+    ASSERT_TRUE(component);
+    ASSERT_TRUE(IsEqual("15", component->getCalculated(kPropertyText).asString()));
+
+    // 20.524 seconds until 12:16:00
+    ASSERT_EQ(20524, root->nextTime());
+
+    root->updateTime(20523);
+    ASSERT_TRUE(IsEqual("15", component->getCalculated(kPropertyText).asString()));
+    ASSERT_TRUE(CheckDirty(root));
+
+    root->updateTime(root->nextTime());
+    ASSERT_TRUE(IsEqual("16", component->getCalculated(kPropertyText).asString()));
+    ASSERT_TRUE(CheckDirty(root, component));
+    ASSERT_EQ(20524 + 60000, root->nextTime());
+}
@@ -0,0 +1,241 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <sstream>
+
+#include "../testeventloop.h"
+
+using namespace apl;
+
+class InputRecorderTest : public DocumentWrapper {
+public:
+    InputRecorderTest() : DocumentWrapper() {
+        config->measure(InputReplayer::textMeasurement());
+    }
+
+    /**
+     * Drive the current root context through a short session that touches each type of input
+     * the document reacts to.
+     */
+    void runSession() {
+        advanceTime(100);
+        performClick(50, 50);
+        advanceTime(100);
+        root->handleKeyboard(kKeyDown, Keyboard("KeyA", "a"));
+        advanceTime(100);
+        root->executeCommands(
+            JsonData(R"([{"type": "SetValue", "componentId": "extra", "property": "text", "value": "external"}])").get(),
+            false);
+        root->updateDisplayState(kDisplayStateBackground);
+        advanceTime(100);
+    }
+};
+
+static const char *RECORDED_DOC = R"({
+  "type": "APL",
+  "version": "1.8",
+  "handleKeyDown": [
+    {
+      "when": "${event.keyboard.code == 'KeyA'}",
+      "commands": {
+        "type": "SetValue",
+        "componentId": "label",
+        "property": "text",
+        "value": "key"
+      }
+    }
+  ],
+  "mainTemplate": {
+    "items": {
+      "type": "Container",
+      "items": [
+        {
+          "type": "TouchWrapper",
+          "width": 100,
+          "height": 100,
+          "onPress": {
+            "type": "SetValue",
+            "componentId": "label",
+            "property": "text",
+            "value": "pressed"
+          }
+        },
+        {
+          "type": "Text",
+          "id": "label",
+          "text": "start"
+        },
+        {
+          "type": "Text",
+          "id": "extra",
+          "text": "none"
+        },
+        {
+          "type": "Text",
+          "id": "state",
+          "text": "${displayState}"
+        }
+      ]
+    }
+  }
+})";
+
+TEST_F(InputRecorderTest, Record)
+{
+    loadDocument(RECORDED_DOC);
+
+    auto recorder = InputRecorder::create();
+    root->setInputRecorder(recorder);
+    ASSERT_EQ(recorder, root->getInputRecorder());
+
+    runSession();
+
+    // Four time updates, two pointer events, a key press, the external command and the display state
+    ASSERT_EQ(9, recorder->size());
+
+    std::vector<std::string> lines;
+    std::istringstream stream(recorder->serialize());
+    std::string line;
+    while (std::getline(stream, line))
+        lines.emplace_back(line);
+
+    ASSERT_EQ(9, lines.size());
+    ASSERT_EQ(R"({"time":100.0,"type":"updateTime"})", lines.at(0));
+    ASSERT_EQ(R"({"time":100.0,"type":"pointer","event":1,"x":50.0,"y":50.0,"id":0,"pointer":0})", lines.at(1));
+    ASSERT_EQ(R"({"time":100.0,"type":"pointer","event":2,"x":50.0,"y":50.0,"id":0,"pointer":0})", lines.at(2));
+    ASSERT_EQ(R"({"time":200.0,"type":"keyboard","handler":0,"keyboard":{"code":"KeyA","key":"a",)"
+              R"("repeat":false,"altKey":false,"ctrlKey":false,"metaKey":false,"shiftKey":false}})", lines.at(4));
+    ASSERT_EQ(R"({"time":300.0,"type":"executeCommands","commands":[{"componentId":"extra","property":"text",)"
+              R"("type":"SetValue","value":"external"}],"fastMode":false})", lines.at(6));
+    ASSERT_EQ(R"({"time":300.0,"type":"displayState","state":1})", lines.at(7));
+
+    // Detaching the recorder stops recording
+    root->setInputRecorder(nullptr);
+    advanceTime(100);
+    ASSERT_EQ(9, recorder->size());
+
+    recorder->clear();
+    ASSERT_EQ(0, recorder->size());
+    ASSERT_EQ("", recorder->serialize());
+}
+
+TEST_F(InputRecorderTest, Replay)
+{
+    loadDocument(RECORDED_DOC);
+
+    auto recorder = InputRecorder::create();
+    root->setInputRecorder(recorder);
+    runSession();
+
+    ASSERT_EQ("key", component->getCoreChildAt(1)->getCalculated(kPropertyText).asString());
+    ASSERT_EQ("external", component->getCoreChildAt(2)->getCalculated(kPropertyText).asString());
+    ASSERT_EQ("background", component->getCoreChildAt(3)->getCalculated(kPropertyText).asString());
+
+    auto replayer = InputReplayer::create(recorder->serialize());
+    ASSERT_TRUE(replayer);
+    ASSERT_EQ(9, replayer->size());
+    ASSERT_FALSE(replayer->done());
+
+    // Replay into a fresh root context with its own clock
+    auto replayLoop = std::make_shared<TestTimeManager>();
+    auto replayConfig = RootConfig::create();
+    replayConfig->timeManager(replayLoop).measure(InputReplayer::textMeasurement());
+    auto replayRoot = RootContext::create(metrics, content, *replayConfig);
+    ASSERT_TRUE(replayRoot);
+
+    // Step through the first two records: the clock moves, then the pointer goes down
+    ASSERT_TRUE(replayer->step(replayRoot));
+    ASSERT_EQ(100, replayRoot->currentTime());
+    ASSERT_TRUE(replayer->step(replayRoot));
+    ASSERT_EQ(2, replayer->position());
+
+    replayer->replay(replayRoot);
+    ASSERT_TRUE(replayer->done());
+    ASSERT_FALSE(replayer->step(replayRoot));
+
+    auto top = std::static_pointer_cast<CoreComponent>(replayRoot->topComponent());
+    ASSERT_EQ("key", top->getCoreChildAt(1)->getCalculated(kPropertyText).asString());
+    ASSERT_EQ("external", top->getCoreChildAt(2)->getCalculated(kPropertyText).asString());
+    ASSERT_EQ("background", top->getCoreChildAt(3)->getCalculated(kPropertyText).asString());
+    ASSERT_EQ(400, replayRoot->currentTime());
+
+    replayRoot->clearPending();
+    while (replayRoot->hasEvent())
+        replayRoot->popEvent();
+
+    // The layout is identical because both sessions used the same text measurement
+    for (int i = 0; i < 4; i++)
+        ASSERT_EQ(component->getCoreChildAt(i)->getCalculated(kPropertyBounds),
+                  top->getCoreChildAt(i)->getCalculated(kPropertyBounds));
+}
+
+TEST_F(InputRecorderTest, ReplayPress)
+{
+    loadDocument(RECORDED_DOC);
+
+    auto recorder = InputRecorder::create();
+    root->setInputRecorder(recorder);
+    advanceTime(100);
+    performClick(50, 50);
+    advanceTime(100);
+    ASSERT_EQ("pressed", component->getCoreChildAt(1)->getCalculated(kPropertyText).asString());
+
+    auto replayLoop = std::make_shared<TestTimeManager>();
+    auto replayConfig = RootConfig::create();
+    replayConfig->timeManager(replayLoop).measure(InputReplayer::textMeasurement());
+    auto replayRoot = RootContext::create(metrics, content, *replayConfig);
+    ASSERT_TRUE(replayRoot);
+
+    InputReplayer::create(recorder->serialize())->replay(replayRoot);
+
+    auto top = std::static_pointer_cast<CoreComponent>(replayRoot->topComponent());
+    ASSERT_EQ("pressed", top->getCoreChildAt(1)->getCalculated(kPropertyText).asString());
+}
+
+TEST_F(InputRecorderTest, ConfigurationChange)
+{
+    loadDocument(RECORDED_DOC);
+
+    auto recorder = InputRecorder::create();
+    root->setInputRecorder(recorder);
+    configChange(ConfigurationChange(400, 300).theme("light").fontScale(2.0));
+    root->configurationChange(ConfigurationChange().screenReader(true));
+
+    ASSERT_EQ(R"({"time":0.0,"type":"configurationChange","change":{"width":400,"height":300,"theme":"light",)"
+              R"("fontScale":2.0}})" "\n"
+              R"({"time":0.0,"type":"configurationChange","change":{"screenReader":true}})" "\n",
+              recorder->serialize());
+
+    // Both changes round trip through the replayer
+    auto replayer = InputReplayer::create(recorder->serialize());
+    ASSERT_TRUE(replayer);
+    ASSERT_EQ(2, replayer->size());
+
+    root->clearPending();
+    while (root->hasEvent())
+        root->popEvent();
+}
+
+TEST_F(InputRecorderTest, BadTrace)
+{
+    ASSERT_FALSE(InputReplayer::create("not json"));
+    ASSERT_FALSE(InputReplayer::create(R"({"time":0.0})"));
+    ASSERT_FALSE(InputReplayer::create(R"({"time":0.0,"type":"unknown"})"));
+
+    // Blank lines are ignored
+    auto replayer = InputReplayer::create("\n" R"({"time":0.0,"type":"cancelExecution"})" "\n\n");
+    ASSERT_TRUE(replayer);
+    ASSERT_EQ(1, replayer->size());
+}
@@ -484,3 +484,79 @@ TEST_F(StylesTest, ComponentStyling)
     ASSERT_EQ(kVectorGraphicAlignBottom, vectorGraphic->getCalculated(kPropertyAlign).asInt());
     ASSERT_EQ(kVectorGraphicScaleBestFill, vectorGraphic->getCalculated(kPropertyScale).asInt());
 }
+
+static const char *STATE_MASK = R"({
+  "type": "APL",
+  "version": "1.1",
+  "styles": {
+    "plain": {
+      "values": { "backgroundColor": "blue" }
+    },
+    "framePressed": {
+      "values": [
+        { "backgroundColor": "blue" },
+        { "when": "${state.pressed}", "backgroundColor": "red" }
+      ]
+    },
+    "textHover": {
+      "values": { "color": "${state.hover ? 'red' : 'blue'}" }
+    },
+    "extendsBoth": {
+      "extends": [ "framePressed", "textHover" ],
+      "values": { "opacity": 0.5 }
+    },
+    "anyState": {
+      "values": { "when": "${state}", "opacity": 0.5 }
+    }
+  },
+  "mainTemplate": {
+    "items": {
+      "type": "Frame",
+      "style": "framePressed",
+      "items": {
+        "type": "Text",
+        "style": "textHover",
+        "inheritParentState": true,
+        "text": "Hello"
+      }
+    }
+  }
+})";
+
+TEST_F(StylesTest, StateMask)
+{
+    loadDocument(STATE_MASK);
+
+    auto styles = context->styles();
+    ASSERT_EQ(0, styles->getStyleDefinition("plain")->stateMask(context));
+    ASSERT_EQ(1u << kStatePressed, styles->getStyleDefinition("framePressed")->stateMask(context));
+    ASSERT_EQ(1u << kStateHover, styles->getStyleDefinition("textHover")->stateMask(context));
+    ASSERT_EQ((1u << kStatePressed) | (1u << kStateHover),
+              styles->getStyleDefinition("extendsBoth")->stateMask(context));
+    ASSERT_EQ((1u << kStatePropertyCount) - 1, styles->getStyleDefinition("anyState")->stateMask(context));
+}
+
+TEST_F(StylesTest, StateSelectiveUpdate)
+{
+    loadDocument(STATE_MASK);
+
+    auto text = component->getCoreChildAt(0);
+    ASSERT_EQ(Color(Color::BLUE), component->getCalculated(kPropertyBackgroundColor).getColor());
+    ASSERT_EQ(Color(Color::BLUE), text->getCalculated(kPropertyColor).getColor());
+
+    // The frame style ignores hover, the text inheriting the state is still restyled
+    component->setState(kStateHover, true);
+    ASSERT_EQ(Color(Color::BLUE), component->getCalculated(kPropertyBackgroundColor).getColor());
+    ASSERT_EQ(Color(Color::RED), text->getCalculated(kPropertyColor).getColor());
+    ASSERT_TRUE(CheckDirty(component));
+
+    component->setState(kStatePressed, true);
+    ASSERT_EQ(Color(Color::RED), component->getCalculated(kPropertyBackgroundColor).getColor());
+    ASSERT_EQ(Color(Color::RED), text->getCalculated(kPropertyColor).getColor());
+    root->clearDirty();
+
+    // Disabling clears both pressed and hover
+    component->setState(kStateDisabled, true);
+    ASSERT_EQ(Color(Color::BLUE), component->getCalculated(kPropertyBackgroundColor).getColor());
+    ASSERT_EQ(Color(Color::BLUE), text->getCalculated(kPropertyColor).getColor());
+}
@@ -15,6 +15,7 @@
 
 #include "../testeventloop.h"
 
+#include "apl/component/vectorgraphiccomponent.h"
 #include "apl/focus/focusmanager.h"
 #include "apl/graphic/graphic.h"
 #include "apl/primitives/object.h"
@@ -539,6 +540,7 @@ TEST_F(GraphicComponentTest, StyleTestWithAlignment)
     ASSERT_EQ(0, path->getDirtyProperties().size());
     ASSERT_EQ(0, graphic->getDirty().size());
     component->setState(kStatePressed, true);
+    root->clearPending();  // Media bounds are resolved in the layout pass
 
     ASSERT_EQ(Rect(924, 350, 100, 100), component->getCalculated(kPropertyMediaBounds).getRect());
     ASSERT_TRUE(CheckDirty(component, kPropertyAlign, kPropertyMediaBounds, kPropertyVisualHash));
@@ -617,9 +619,12 @@ TEST_F(GraphicComponentTest, StyleTestWithStretch)
     ASSERT_TRUE(IsEqual(Object("M400,1600 L0,0"), path->getValue(kGraphicPropertyPathData)));
     ASSERT_TRUE(CheckDirty(path));
 
-    // Change the state to pressed
+    // Change the state to pressed.  Scale and align both change, but the media bounds are computed once.
+    auto vg = std::static_pointer_cast<VectorGraphicComponent>(component);
+    auto updateCount = vg->getMediaBoundsUpdateCount();
     component->setState(kStatePressed, true);
-
+    root->clearPending();
+    ASSERT_EQ(updateCount + 1, vg->getMediaBoundsUpdateCount());
 
     // The graphic itself should have a new viewport height and width
     ASSERT_EQ(100, graphic->getViewportWidth());
@@ -722,6 +727,7 @@ TEST_F(GraphicComponentTest, SetValue)
 
     // Change the alignment.  This should only affect the media bounds
     executeCommand("SetValue", {{"componentId", "MyVG"}, {"property", "align"}, {"value", "bottom-right"}}, true);
+    root->clearPending();  // Media bounds are resolved in the layout pass
 
     // Verify that there are no graphic changes (it moved, but didn't resize)
     ASSERT_TRUE(CheckDirty(graphic));
@@ -734,6 +740,7 @@ TEST_F(GraphicComponentTest, SetValue)
 
     // Change the scaling factor.  This will resize the graphic
     executeCommand("SetValue", {{"componentId", "MyVG"}, {"property", "scale"}, {"value", "best-fit"}}, true);
+    root->clearPending();  // Media bounds are resolved in the layout pass
 
     // The 'best-fit' should have scaled up uniformly by a factor of 2
     ASSERT_EQ(200, graphic->getViewportWidth());
@@ -0,0 +1,253 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "../testeventloop.h"
+
+#include "apl/graphic/graphicelementpath.h"
+#include "apl/graphic/pathgeometry.h"
+
+using namespace apl;
+
+class PathGeometryTest : public DocumentWrapper {};
+
+static ::testing::AssertionResult
+CheckIntervals(const std::vector<PathInterval>& expected, const std::vector<PathInterval>& actual)
+{
+    if (expected.size() != actual.size())
+        return ::testing::AssertionFailure() << "Expected " << expected.size() << " intervals, got " << actual.size();
+
+    for (size_t i = 0; i < expected.size(); i++) {
+        if (std::abs(expected[i].first - actual[i].first) > 0.001 ||
+            std::abs(expected[i].second - actual[i].second) > 0.001)
+            return ::testing::AssertionFailure()
+                   << "Interval " << i << " expected [" << expected[i].first << "," << expected[i].second
+                   << "] got [" << actual[i].first << "," << actual[i].second << "]";
+    }
+
+    return ::testing::AssertionSuccess();
+}
+
+static ::testing::AssertionResult
+CheckBounds(const Rect& expected, const Rect& actual)
+{
+    if (std::abs(expected.getLeft() - actual.getLeft()) > 0.01 ||
+        std::abs(expected.getTop() - actual.getTop()) > 0.01 ||
+        std::abs(expected.getRight() - actual.getRight()) > 0.01 ||
+        std::abs(expected.getBottom() - actual.getBottom()) > 0.01)
+        return ::testing::AssertionFailure() << "Expected " << expected.toString() << " got " << actual.toString();
+
+    return ::testing::AssertionSuccess();
+}
+
+TEST_F(PathGeometryTest, Lines)
+{
+    auto path = PathGeometry::create("M10,10 h20 v10 H10 z");
+    ASSERT_TRUE(path->valid());
+    ASSERT_FALSE(path->empty());
+    ASSERT_EQ(Rect(10, 10, 20, 10), path->getBounds());
+    ASSERT_EQ(60, path->getLength());
+
+    ASSERT_EQ(1, path->getSubpaths().size());
+    ASSERT_TRUE(path->getSubpaths().at(0).closed);
+    ASSERT_EQ(5, path->getPoints().size());
+
+    ASSERT_EQ(Point(10, 10), path->getPointAtDistance(0));
+    ASSERT_EQ(Point(25, 10), path->getPointAtDistance(15));
+    ASSERT_EQ(Point(30, 15), path->getPointAtDistance(25));
+    ASSERT_EQ(Point(10, 10), path->getPointAtDistance(60));
+    ASSERT_EQ(Point(10, 10), path->getPointAtDistance(100));  // Clamped
+
+    auto segment = path->getSegment(15, 25);
+    ASSERT_EQ(3, segment.size());
+    ASSERT_EQ(Point(25, 10), segment.at(0));
+    ASSERT_EQ(Point(30, 10), segment.at(1));
+    ASSERT_EQ(Point(30, 15), segment.at(2));
+
+    ASSERT_TRUE(path->contains(Point(20, 15)));
+    ASSERT_FALSE(path->contains(Point(5, 15)));
+    ASSERT_FALSE(path->contains(Point(20, 25)));
+}
+
+TEST_F(PathGeometryTest, Syntax)
+{
+    // Implicit commands, run-together numbers and exponents
+    auto path = PathGeometry::create("m0-0 10.5.5 1e1,0l-1-1");
+    ASSERT_TRUE(path->valid());
+    ASSERT_EQ(4, path->getPoints().size());
+    ASSERT_EQ(Point(10.5, 0.5), path->getPoints().at(1));
+    ASSERT_EQ(Point(20.5, 0.5), path->getPoints().at(2));
+    ASSERT_EQ(Point(19.5, -0.5), path->getPoints().at(3));
+
+    // Parsing stops at the first error, keeping the segments that came before it
+    auto partial = PathGeometry::create("M0,0 L10,0 L20 X 30");
+    ASSERT_FALSE(partial->valid());
+    ASSERT_EQ(10, partial->getLength());
+
+    ASSERT_FALSE(PathGeometry::create("L10,10")->valid());
+
+    auto empty = PathGeometry::create("");
+    ASSERT_TRUE(empty->valid());
+    ASSERT_TRUE(empty->empty());
+    ASSERT_EQ(0, empty->getLength());
+    ASSERT_EQ(Rect(0, 0, 0, 0), empty->getBounds());
+    ASSERT_EQ(Point(), empty->getPointAtDistance(5));
+
+    // A lone moveto does not draw anything
+    ASSERT_TRUE(PathGeometry::create("M10,10")->empty());
+}
+
+TEST_F(PathGeometryTest, Curves)
+{
+    // The control point lies well outside of the curve, but the bounds are tight
+    auto quad = PathGeometry::create("M0,0 Q50,100 100,0");
+    ASSERT_TRUE(CheckBounds(Rect(0, 0, 100, 50), quad->getBounds()));
+    ASSERT_NEAR(147.89, quad->getLength(), 0.25);
+
+    auto cubic = PathGeometry::create("M0,0 C0,100 100,100 100,0");
+    ASSERT_TRUE(CheckBounds(Rect(0, 0, 100, 75), cubic->getBounds()));
+
+    // Smooth curves reflect the previous control point
+    auto smooth = PathGeometry::create("M0,0 C0,100 100,100 100,0 S200,-100 200,0");
+    ASSERT_TRUE(CheckBounds(Rect(0, -75, 200, 150), smooth->getBounds()));
+    ASSERT_NEAR(2 * cubic->getLength(), smooth->getLength(), 0.01);
+
+    auto shorthand = PathGeometry::create("M0,0 Q50,100 100,0 T200,0");
+    ASSERT_TRUE(CheckBounds(Rect(0, -50, 200, 100), shorthand->getBounds()));
+
+    // Flattening keeps every vertex on the curve
+    for (const auto& p : quad->getPoints()) {
+        auto t = p.getX() / 100;
+        ASSERT_NEAR(200 * t * (1 - t), p.getY(), 0.01);
+    }
+}
+
+TEST_F(PathGeometryTest, Arcs)
+{
+    // A full circle made from two half-circle arcs
+    auto circle = PathGeometry::create("M0,50 A50,50 0 1,1 100,50 A50,50 0 1,1 0,50 z");
+    ASSERT_TRUE(circle->valid());
+    ASSERT_TRUE(CheckBounds(Rect(0, 0, 100, 100), circle->getBounds()));
+    ASSERT_NEAR(100 * M_PI, circle->getLength(), 0.5);
+    ASSERT_TRUE(circle->contains(Point(50, 50)));
+    ASSERT_FALSE(circle->contains(Point(5, 5)));
+
+    // Radii that are too small are scaled up to reach the end point
+    auto small = PathGeometry::create("M0,0 a1,1 0 0,1 100,0");
+    ASSERT_NEAR(50 * M_PI, small->getLength(), 0.5);
+    ASSERT_TRUE(CheckBounds(Rect(0, -50, 100, 50), small->getBounds()));
+
+    // Zero radius is a straight line
+    auto line = PathGeometry::create("M0,0 A0,10 0 0 1 30,40");
+    ASSERT_EQ(50, line->getLength());
+}
+
+TEST_F(PathGeometryTest, Dashes)
+{
+    auto path = PathGeometry::create("M0,0 h100");
+
+    ASSERT_TRUE(CheckIntervals({{0, 10}, {30, 40}, {60, 70}, {90, 100}}, path->getDashIntervals({10, 20}, 0)));
+
+    // The offset shifts the pattern towards the start of the path
+    ASSERT_TRUE(CheckIntervals({{0, 5}, {25, 35}, {55, 65}, {85, 95}}, path->getDashIntervals({10, 20}, 5)));
+    ASSERT_TRUE(CheckIntervals({{5, 15}, {35, 45}, {65, 75}, {95, 100}}, path->getDashIntervals({10, 20}, -5)));
+    ASSERT_TRUE(CheckIntervals(path->getDashIntervals({10, 20}, 5), path->getDashIntervals({10, 20}, 305)));
+
+    // An odd-length pattern is repeated
+    ASSERT_TRUE(CheckIntervals({{0, 10}, {20, 30}, {40, 50}, {60, 70}, {80, 90}}, path->getDashIntervals({10}, 0)));
+
+    // Zero-length dashes are kept for line caps
+    ASSERT_TRUE(CheckIntervals({{0, 0}, {50, 50}}, path->getDashIntervals({0, 50}, 0)));
+
+    // Scaling supports "pathLength"
+    ASSERT_TRUE(CheckIntervals({{0, 20}, {60, 80}}, path->getDashIntervals({1, 2}, 0, 20)));
+
+    // Invalid patterns draw the whole path
+    ASSERT_TRUE(CheckIntervals({{0, 100}}, path->getDashIntervals({}, 0)));
+    ASSERT_TRUE(CheckIntervals({{0, 100}}, path->getDashIntervals({0, 0}, 0)));
+    ASSERT_TRUE(CheckIntervals({{0, 100}}, path->getDashIntervals({10, -1}, 0)));
+
+    // The pattern restarts on each subpath
+    auto twoLines = PathGeometry::create("M0,0 h25 M0,10 h25");
+    ASSERT_EQ(2, twoLines->getSubpaths().size());
+    ASSERT_TRUE(CheckIntervals({{0, 10}, {20, 25}, {25, 35}, {45, 50}}, twoLines->getDashIntervals({10, 10}, 0)));
+
+    // A dash on the second subpath starts on that subpath
+    auto segment = twoLines->getSegment(25, 35);
+    ASSERT_EQ(2, segment.size());
+    ASSERT_EQ(Point(0, 10), segment.at(0));
+    ASSERT_EQ(Point(10, 10), segment.at(1));
+}
+
+static const char *PATH_ELEMENT = R"apl(
+{
+  "type": "APL",
+  "version": "1.8",
+  "graphics": {
+    "line": {
+      "type": "AVG",
+      "version": "1.2",
+      "height": 100,
+      "width": 100,
+      "parameters": [ "Data", "Offset" ],
+      "items": {
+        "type": "path",
+        "pathData": "${Data}",
+        "pathLength": 10,
+        "strokeDashArray": [ 1 ],
+        "strokeDashOffset": "${Offset}"
+      }
+    }
+  },
+  "mainTemplate": {
+    "items": {
+      "type": "VectorGraphic",
+      "id": "vg",
+      "source": "line",
+      "Data": "M0,0 h40",
+      "Offset": 0
+    }
+  }
+}
+)apl";
+
+TEST_F(PathGeometryTest, PathElement)
+{
+    loadDocument(PATH_ELEMENT);
+    ASSERT_TRUE(component);
+
+    auto graphic = component->getCalculated(kPropertyGraphic).getGraphic();
+    ASSERT_TRUE(graphic);
+    auto element = graphic->getRoot()->getChildAt(0);
+    ASSERT_EQ(kGraphicElementTypePath, element->getType());
+    auto path = std::static_pointer_cast<GraphicElementPath>(element);
+
+    auto geometry = path->getGeometry();
+    ASSERT_EQ(40, geometry->getLength());
+    ASSERT_EQ(geometry, path->getGeometry());  // Cached
+
+    // The path length of 10 scales the dash pattern by 4
+    ASSERT_TRUE(CheckIntervals({{0, 4}, {8, 12}, {16, 20}, {24, 28}, {32, 36}}, path->getDashIntervals()));
+
+    // Animating the offset reuses the geometry
+    executeCommand("SetValue", {{"componentId", "vg"}, {"property", "Offset"}, {"value", 1}}, true);
+    ASSERT_TRUE(CheckIntervals({{4, 8}, {12, 16}, {20, 24}, {28, 32}, {36, 40}}, path->getDashIntervals()));
+    ASSERT_EQ(geometry, path->getGeometry());
+
+    // Changing the path data rebuilds the geometry
+    executeCommand("SetValue", {{"componentId", "vg"}, {"property", "Data"}, {"value", "M0,0 v20"}}, true);
+    ASSERT_NE(geometry, path->getGeometry());
+    ASSERT_EQ(20, path->getGeometry()->getLength());
+    ASSERT_TRUE(CheckBounds(Rect(0, 0, 0, 20), path->getGeometry()->getBounds()));
+}
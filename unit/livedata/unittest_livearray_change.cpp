@@ -386,3 +386,54 @@ TEST_F(LiveArrayChangeTest, CombinedIteratorChanges)
     }));
     root->clearPending();
 }
+
+static const char *INDEX_TEST = R"({
+  "type": "APL",
+  "version": "1.3",
+  "mainTemplate": {
+    "items": {
+      "type": "Container",
+      "items": [
+        { "type": "Text", "id": "first", "text": "${TestArray[0].name}" },
+        { "type": "Text", "id": "third", "text": "${TestArray[2]}" },
+        { "type": "Text", "id": "length", "text": "${TestArray.length}" }
+      ]
+    }
+  }
+})";
+
+// Dependants on a fixed index are only recalculated when the item at that index may have changed
+TEST_F(LiveArrayChangeTest, IndexDependants)
+{
+    auto item = std::make_shared<ObjectMap>(ObjectMap{{"name", "Alpha"}});
+    auto myArray = LiveArray::create(ObjectArray{Object(item), "Beta", "Gamma"});
+    config->liveData("TestArray", myArray);
+
+    loadDocument(INDEX_TEST);
+    ASSERT_TRUE(component);
+
+    auto first = root->findComponentById("first");
+    auto third = root->findComponentById("third");
+    auto length = root->findComponentById("length");
+
+    // Change the first item behind the back of the live array, it is only picked up by recalculated dependants
+    (*item)["name"] = "Omega";
+    ASSERT_TRUE(myArray->update(2, "Delta"));
+    root->clearPending();
+    ASSERT_TRUE(IsEqual("Alpha", first->getCalculated(kPropertyText).asString()));
+    ASSERT_TRUE(IsEqual("Delta", third->getCalculated(kPropertyText).asString()));
+    ASSERT_TRUE(IsEqual("3", length->getCalculated(kPropertyText).asString()));
+
+    // Appending does not move the existing items
+    myArray->push_back("Epsilon");
+    root->clearPending();
+    ASSERT_TRUE(IsEqual("Alpha", first->getCalculated(kPropertyText).asString()));
+    ASSERT_TRUE(IsEqual("4", length->getCalculated(kPropertyText).asString()));
+
+    // Removing the first item moves everything
+    ASSERT_TRUE(myArray->remove(0));
+    root->clearPending();
+    ASSERT_TRUE(IsEqual("", first->getCalculated(kPropertyText).asString()));
+    ASSERT_TRUE(IsEqual("Epsilon", third->getCalculated(kPropertyText).asString()));
+    ASSERT_TRUE(IsEqual("3", length->getCalculated(kPropertyText).asString()));
+}
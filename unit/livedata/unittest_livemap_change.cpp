@@ -280,4 +280,54 @@ TEST_F(LiveMapChangeTest, PopulateLayoutMap)
     root->clearPending();
 
     ASSERT_TRUE(IsEqual("think so", component->getCalculated(kPropertyText).asString()));
-}
\ No newline at end of file
+}
+
+static const char *MEMBER_TEST = R"({
+  "type": "APL",
+  "version": "1.3",
+  "mainTemplate": {
+    "items": {
+      "type": "Container",
+      "items": [
+        { "type": "Text", "id": "progress", "text": "${TestMap.progress}" },
+        { "type": "Text", "id": "title", "text": "${TestMap.title.name}" },
+        { "type": "Text", "id": "both", "text": "${TestMap.title.name} ${TestMap.progress}" }
+      ]
+    }
+  }
+})";
+
+// Only dependants referring to a changed key are recalculated
+TEST_F(LiveMapChangeTest, MemberDependants)
+{
+    auto title = std::make_shared<ObjectMap>(ObjectMap{{"name", "Song"}});
+    auto myMap = LiveMap::create(ObjectMap{{"progress", 1}, {"title", Object(title)}});
+    config->liveData("TestMap", myMap);
+
+    loadDocument(MEMBER_TEST);
+    ASSERT_TRUE(component);
+
+    auto progress = root->findComponentById("progress");
+    auto name = root->findComponentById("title");
+    auto both = root->findComponentById("both");
+    ASSERT_TRUE(IsEqual("Song 1", both->getCalculated(kPropertyText).asString()));
+
+    // Change the title behind the back of the live map, it is only picked up by recalculated dependants
+    (*title)["name"] = "Album";
+    myMap->set("progress", 2);
+    root->clearPending();
+    ASSERT_TRUE(IsEqual("2", progress->getCalculated(kPropertyText).asString()));
+    ASSERT_TRUE(IsEqual("Song", name->getCalculated(kPropertyText).asString()));
+    ASSERT_TRUE(IsEqual("Album 2", both->getCalculated(kPropertyText).asString()));
+
+    myMap->set("title", Object(std::make_shared<ObjectMap>(ObjectMap{{"name", "Single"}})));
+    root->clearPending();
+    ASSERT_TRUE(IsEqual("Single", name->getCalculated(kPropertyText).asString()));
+    ASSERT_TRUE(IsEqual("Single 2", both->getCalculated(kPropertyText).asString()));
+
+    // Removed keys are changed as well
+    myMap->remove("progress");
+    root->clearPending();
+    ASSERT_TRUE(IsEqual("", progress->getCalculated(kPropertyText).asString()));
+    ASSERT_TRUE(IsEqual("Single ", both->getCalculated(kPropertyText).asString()));
+}
@@ -48,6 +48,7 @@ public:
         auto player = std::make_shared<TestMediaPlayer>(std::move(callback), std::move(self));
         if (mEventCallback) player->setEventCallback(mEventCallback);
         mPlayers.emplace_back(player);
+        mCreatedCount++;
         return player;
     }
 
@@ -94,10 +95,16 @@ public:
 
     void setEventCallback(TestMediaPlayer::EventCallback callback) { mEventCallback = callback; }
 
+    /**
+     * @return The total number of media players created by this factory
+     */
+    int getCreatedCount() const { return mCreatedCount; }
+
 private:
     std::vector<std::weak_ptr<TestMediaPlayer>> mPlayers;
     std::map<std::string, FakeContent> mFakeContent;
     TestMediaPlayer::EventCallback mEventCallback;
+    int mCreatedCount = 0;
 };
 
 } // namespace apl
@@ -32,14 +32,24 @@ public:
 
     template <class... Args>
     ::testing::AssertionResult MediaRequested(EventMediaType mediaType, Args... args) {
+        return MediaEvent(kEventTypeMediaRequest, mediaType, args...);
+    }
+
+    template <class... Args>
+    ::testing::AssertionResult MediaCancelled(EventMediaType mediaType, Args... args) {
+        return MediaEvent(kEventTypeMediaCancel, mediaType, args...);
+    }
+
+    template <class... Args>
+    ::testing::AssertionResult MediaEvent(EventType eventType, EventMediaType mediaType, Args... args) {
         if (!root->hasEvent())
             return ::testing::AssertionFailure() << "No event.";
 
-        // Event should be fired that requests media to be loaded.
+        // Event should be fired that requests (or cancels) media to be loaded.
         auto event = root->popEvent();
         auto type = event.getType();
-        if (kEventTypeMediaRequest != type)
-            return ::testing::AssertionFailure() << "Wrong event type. Expected: " << kEventTypeMediaRequest
+        if (eventType != type)
+            return ::testing::AssertionFailure() << "Wrong event type. Expected: " << eventType
                                                  << ", actual: "  << type;
 
         if (event.getValue(kEventPropertyMediaType).asInt() != mediaType) {
@@ -56,7 +66,7 @@ public:
             actualSources.emplace(m.getString());
 
         if (expectedSources != actualSources)
-            return ::testing::AssertionFailure() << "Source mismatch";
+            return ::testing::AssertionFailure() << "Source mismatch: " << sources.toDebugString();
 
         return ::testing::AssertionSuccess();
     }
@@ -2326,3 +2336,146 @@ TEST_F(MediaManagerTest, VideoWithMultipleHeaders) {
     ASSERT_EQ(headers.at(3), "D: A");
     ASSERT_EQ(headers.at(4), "E: F");
 }
+
+static const char* FULL_SCREEN_SEQUENCE = R"({
+  "type": "APL",
+  "version": "1.6",
+  "mainTemplate": {
+    "item": {
+      "type": "Sequence",
+      "height": "100%",
+      "width": "100%",
+      "data": [0, 1, 2, 3, 4, 5, 6, 7, 8, 9],
+      "item": {
+        "type": "Image",
+        "source": "universe${data}",
+        "height": 100,
+        "width": "100%"
+      }
+    }
+  }
+})";
+
+TEST_F(MediaManagerTest, RequestLimit) {
+    config->set(RootProperty::kMaxMediaRequestsInFlight, 2);
+    metrics.size(200, 150);
+    loadDocument(FULL_SCREEN_SEQUENCE);
+    advanceTime(10);
+
+    // Only the two visible images are requested, even though more have been laid out
+    ASSERT_TRUE(MediaRequested(kEventMediaTypeImage, "universe0", "universe1"));
+    ASSERT_FALSE(root->hasEvent());
+
+    // Each returned image frees a slot for the next closest one
+    root->mediaLoaded("universe1");
+    root->clearPending();
+    ASSERT_TRUE(MediaRequested(kEventMediaTypeImage, "universe2"));
+    ASSERT_FALSE(root->hasEvent());
+
+    // Only four images have been laid out, so a single request goes out
+    root->mediaLoadFailed("universe0");
+    root->mediaLoaded("universe2");
+    root->clearPending();
+    ASSERT_TRUE(MediaRequested(kEventMediaTypeImage, "universe3"));
+    ASSERT_FALSE(root->hasEvent());
+}
+
+TEST_F(MediaManagerTest, RequestOrder) {
+    config->set(RootProperty::kMaxMediaRequestsInFlight, 2);
+    metrics.size(200, 150);
+    loadDocument(FULL_SCREEN_SEQUENCE);
+    advanceTime(10);
+
+    ASSERT_TRUE(MediaRequested(kEventMediaTypeImage, "universe0", "universe1"));
+    ASSERT_FALSE(root->hasEvent());
+
+    // Scroll so that the 4th and 5th images fill the screen.  They are requested ahead of the
+    // 3rd image, even though it was laid out first.
+    component->update(kUpdateScrollPosition, 325);
+    root->mediaLoaded("universe0");
+    root->mediaLoaded("universe1");
+    root->clearPending();
+
+    ASSERT_TRUE(MediaRequested(kEventMediaTypeImage, "universe3", "universe4"));
+    ASSERT_FALSE(root->hasEvent());
+}
+
+static const char *RELEASED_IMAGES = R"({
+  "type": "APL",
+  "version": "1.6",
+  "mainTemplate": {
+    "item": {
+      "type": "Container",
+      "data": "${TestArray}",
+      "item": {
+        "type": "Image",
+        "source": "universe${data}",
+        "height": 100,
+        "width": 100
+      }
+    }
+  }
+})";
+
+TEST_F(MediaManagerTest, CancelOnRelease) {
+    config->set(RootProperty::kMediaRequestCancelDistance, 1000);
+    auto myArray = LiveArray::create(ObjectArray{0, 1, 2});
+    config->liveData("TestArray", myArray);
+
+    loadDocument(RELEASED_IMAGES);
+    ASSERT_TRUE(MediaRequested(kEventMediaTypeImage, "universe0", "universe1", "universe2"));
+    ASSERT_FALSE(root->hasEvent());
+
+    // The first image arrives before its component is removed; no cancellation is needed
+    root->mediaLoaded("universe0");
+    myArray->remove(0, 2);
+    root->clearPending();
+
+    ASSERT_TRUE(MediaCancelled(kEventMediaTypeImage, "universe1"));
+    ASSERT_FALSE(root->hasEvent());
+
+    // A late response for the cancelled media is ignored
+    root->mediaLoaded("universe1");
+    root->clearPending();
+    ASSERT_FALSE(root->hasEvent());
+}
+
+TEST_F(MediaManagerTest, NoCancelByDefault) {
+    auto myArray = LiveArray::create(ObjectArray{0, 1});
+    config->liveData("TestArray", myArray);
+
+    loadDocument(RELEASED_IMAGES);
+    ASSERT_TRUE(MediaRequested(kEventMediaTypeImage, "universe0", "universe1"));
+
+    myArray->remove(0);
+    root->clearPending();
+    ASSERT_FALSE(root->hasEvent());
+}
+
+TEST_F(MediaManagerTest, CancelDistance) {
+    config->set(RootProperty::kMediaRequestCancelDistance, 100);
+    metrics.size(200, 150);
+    loadDocument(FULL_SCREEN_SEQUENCE);
+    ASSERT_TRUE(MediaRequested(kEventMediaTypeImage, "universe0", "universe1"));
+
+    // The third image is laid out on the next frame.  Images more than 100 dp below the viewport are held back.
+    advanceTime(10);
+    ASSERT_TRUE(MediaRequested(kEventMediaTypeImage, "universe2"));
+    ASSERT_FALSE(root->hasEvent());
+
+    // Scrolling down moves the first image more than 100 dp above the viewport
+    component->update(kUpdateScrollPosition, 300);
+    root->clearPending();
+
+    ASSERT_TRUE(MediaCancelled(kEventMediaTypeImage, "universe0"));
+    ASSERT_TRUE(MediaRequested(kEventMediaTypeImage, "universe3", "universe4", "universe5"));
+    ASSERT_FALSE(root->hasEvent());
+
+    // Scrolling back requests the cancelled image again
+    component->update(kUpdateScrollPosition, 0);
+    root->clearPending();
+
+    ASSERT_TRUE(MediaCancelled(kEventMediaTypeImage, "universe3", "universe4", "universe5"));
+    ASSERT_TRUE(MediaRequested(kEventMediaTypeImage, "universe0"));
+    ASSERT_FALSE(root->hasEvent());
+}
@@ -19,6 +19,7 @@
 
 #include "testmediaplayerfactory.h"
 #include "apl/component/videocomponent.h"
+#include "apl/media/mediaplayerpool.h"
 
 using namespace apl;
 
@@ -1286,3 +1287,147 @@ TEST_F(MediaPlayerTest, DestroyMediaPlayer)
 
     ASSERT_TRUE(std::dynamic_pointer_cast<TestMediaPlayer>(mp)->isReleased());
 }
+
+static const char *VIDEO_LIST = R"apl(
+    {
+      "type": "APL",
+      "version": "1.7",
+      "mainTemplate": {
+        "item": {
+          "type": "Container",
+          "data": "${TestArray}",
+          "item": {
+            "type": "Video",
+            "source": "track${data}",
+            "width": 100,
+            "height": 100,
+            "onPause": {
+              "type": "SendEvent",
+              "arguments": [ "${data}" ]
+            }
+          }
+        }
+      }
+    }
+)apl";
+
+/**
+ * Without a media player pool every new video component creates a new media player
+ */
+TEST_F(MediaPlayerTest, NoPool)
+{
+    auto myArray = LiveArray::create(ObjectArray{1, 2, 3});
+    config->liveData("TestArray", myArray);
+
+    loadDocument(VIDEO_LIST);
+    ASSERT_TRUE(component);
+    ASSERT_EQ(3, component->getChildCount());
+    ASSERT_EQ(3, mediaPlayerFactory->getCreatedCount());
+
+    myArray->clear();
+    root->clearPending();
+    root->clearDirty();
+    ASSERT_EQ(0, component->getChildCount());
+
+    myArray->push_back(4);
+    myArray->push_back(5);
+    myArray->push_back(6);
+    root->clearPending();
+    ASSERT_EQ(3, component->getChildCount());
+    ASSERT_EQ(6, mediaPlayerFactory->getCreatedCount());
+}
+
+/**
+ * With a media player pool the players of released video components are handed to new ones
+ */
+TEST_F(MediaPlayerTest, PoolReusesPlayers)
+{
+    config->set(RootProperty::kMediaPlayerPoolSize, 2);
+    auto myArray = LiveArray::create(ObjectArray{1, 2, 3});
+    config->liveData("TestArray", myArray);
+
+    loadDocument(VIDEO_LIST);
+    ASSERT_TRUE(component);
+    ASSERT_EQ(3, component->getChildCount());
+    ASSERT_EQ(3, mediaPlayerFactory->getCreatedCount());
+
+    // Only two of the three players fit in the pool
+    myArray->clear();
+    root->clearPending();
+    root->clearDirty();
+    ASSERT_EQ(0, component->getChildCount());
+    ASSERT_EQ(2, context->mediaPlayerPool().idleCount());
+
+    myArray->push_back(4);
+    myArray->push_back(5);
+    myArray->push_back(6);
+    root->clearPending();
+    ASSERT_EQ(3, component->getChildCount());
+    ASSERT_EQ(4, mediaPlayerFactory->getCreatedCount());
+    ASSERT_EQ(0, context->mediaPlayerPool().idleCount());
+
+    // A reused player was rebound to its new component and reports events to it
+    auto video = std::static_pointer_cast<VideoComponent>(component->getChildAt(0));
+    auto player = video->getMediaPlayer();
+    ASSERT_TRUE(player);
+    mediaPlayerFactory->addFakeContent({{"track4", 1000, 0, -1}});
+    player->setTrackList({{"track4", {}, 0, 1000, 0}});
+    player->play(ActionRef(nullptr));
+    player->pause();
+    ASSERT_TRUE(CheckSendEvent(root, 4));
+    ASSERT_FALSE(root->hasEvent());
+}
+
+static const char *VIDEO_PAIR = R"apl(
+    {
+      "type": "APL",
+      "version": "1.7",
+      "mainTemplate": {
+        "item": {
+          "type": "Container",
+          "items": [
+            { "type": "Video", "source": "track1", "width": 100, "height": 100 },
+            { "type": "Video", "source": "track2", "width": 100, "height": 100 }
+          ]
+        }
+      }
+    }
+)apl";
+
+static const char *VIDEO_ITEM = R"apl(
+    { "type": "Video", "source": "track3", "width": 100, "height": 100 }
+)apl";
+
+/**
+ * A detached video component hands its player to the pool and binds a new one when attached again
+ */
+TEST_F(MediaPlayerTest, PoolDetachedComponent)
+{
+    config->set(RootProperty::kMediaPlayerPoolSize, 2);
+
+    loadDocument(VIDEO_PAIR);
+    ASSERT_TRUE(component);
+    ASSERT_EQ(2, mediaPlayerFactory->getCreatedCount());
+
+    // The host still holds the detached component, but its player is back in the pool
+    auto video = std::static_pointer_cast<VideoComponent>(component->getChildAt(0));
+    auto player = video->getMediaPlayer();
+    ASSERT_TRUE(player);
+    ASSERT_TRUE(video->remove());
+    ASSERT_FALSE(video->getMediaPlayer());
+    ASSERT_EQ(1, context->mediaPlayerPool().idleCount());
+
+    // A newly attached video component picks up the detached player
+    JsonData data(VIDEO_ITEM);
+    auto child = std::static_pointer_cast<VideoComponent>(component->getContext()->inflate(data.get()));
+    ASSERT_TRUE(child);
+    ASSERT_TRUE(component->appendChild(child));
+    ASSERT_EQ(2, mediaPlayerFactory->getCreatedCount());
+    ASSERT_EQ(0, context->mediaPlayerPool().idleCount());
+    ASSERT_EQ(player, child->getMediaPlayer());
+
+    // Attaching the detached component again binds a fresh player
+    ASSERT_TRUE(component->appendChild(video));
+    ASSERT_TRUE(video->getMediaPlayer());
+    ASSERT_EQ(3, mediaPlayerFactory->getCreatedCount());
+}
@@ -0,0 +1,248 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include "../testeventloop.h"
+
+#include "apl/content/jsondata.h"
+#include "apl/engine/context.h"
+#include "apl/graphic/graphicfilter.h"
+#include "apl/primitives/filter.h"
+#include "apl/primitives/filterengine.h"
+
+using namespace apl;
+
+class FilterEngineTest : public ::testing::Test {
+public:
+    FilterEngineTest() : context(Context::createTestContext(Metrics(), makeDefaultSession())) {}
+
+    Object filters(const char *json) {
+        JsonData data(json);
+        ObjectArray result;
+        for (const auto& m : arrayify(*context, Object(data.get())))
+            result.emplace_back(Filter::create(*context, m));
+        return Object(std::move(result));
+    }
+
+    static std::shared_ptr<Bitmap> bitmap(int width, int height, uint32_t color) {
+        auto result = std::make_shared<Bitmap>(width, height);
+        for (int y = 0; y < height; y++)
+            for (int x = 0; x < width; x++)
+                result->setPixel(x, y, color);
+        return result;
+    }
+
+    ContextPtr context;
+    FilterEngine engine;
+};
+
+TEST_F(FilterEngineTest, ColorBlend)
+{
+    auto red = bitmap(4, 4, 0xff0000ff);
+    auto result = engine.apply({red}, filters(R"([{"type": "Color", "color": "#0000ff80"}, {"type": "Blend"}])"));
+
+    ASSERT_TRUE(result);
+    ASSERT_EQ(4, result->width);
+    ASSERT_EQ(4, result->height);
+
+    // Half-transparent blue over opaque red
+    ASSERT_EQ(0x7f0080ff, result->getPixel(0, 0));
+    ASSERT_EQ(0x7f0080ff, result->getPixel(3, 3));
+}
+
+TEST_F(FilterEngineTest, BlendModes)
+{
+    auto gray = bitmap(2, 2, 0x808080ff);
+
+    auto multiply = engine.apply({gray}, filters(R"([{"type": "Color", "color": "red"}, {"type": "Blend", "mode": "multiply"}])"));
+    ASSERT_EQ(0x800000ff, multiply->getPixel(0, 0));
+
+    auto screen = engine.apply({gray}, filters(R"([{"type": "Color", "color": "red"}, {"type": "Blend", "mode": "screen"}])"));
+    ASSERT_EQ(0xff8080ff, screen->getPixel(0, 0));
+
+    auto difference = engine.apply({gray}, filters(R"([{"type": "Color", "color": "white"}, {"type": "Blend", "mode": "difference"}])"));
+    ASSERT_EQ(0x7f7f7fff, difference->getPixel(1, 1));
+
+    // A gray source over a red backdrop keeps the red hue with the luminosity of the gray
+    auto luminosity = engine.apply({gray}, filters(R"([{"type": "Color", "color": "red"}, {"type": "Blend", "mode": "luminosity", "source": 0, "destination": 1}])"));
+    ASSERT_EQ(0xff4a4aff, luminosity->getPixel(0, 0));
+}
+
+TEST_F(FilterEngineTest, ColorMatrix)
+{
+    auto red = bitmap(2, 2, 0xff0000ff);
+    auto gray = engine.apply({red}, filters(R"({"type": "Grayscale", "amount": 1})"));
+    ASSERT_EQ(0x363636ff, gray->getPixel(0, 0));
+
+    auto none = engine.apply({red}, filters(R"({"type": "Grayscale", "amount": 0})"));
+    ASSERT_EQ(0xff0000ff, none->getPixel(0, 0));
+
+    auto color = bitmap(2, 2, 0x336699ff);
+    auto same = engine.apply({color}, filters(R"({"type": "Saturate", "amount": 1})"));
+    ASSERT_EQ(0x336699ff, same->getPixel(1, 0));
+
+    auto desaturated = engine.apply({color}, filters(R"({"type": "Saturate", "amount": 0})"));
+    auto p = desaturated->getPixel(1, 0);
+    ASSERT_EQ((p >> 24) & 0xff, (p >> 16) & 0xff);
+    ASSERT_EQ((p >> 16) & 0xff, (p >> 8) & 0xff);
+}
+
+TEST_F(FilterEngineTest, Blur)
+{
+    // A uniform image keeps its color; only the alpha fades at the edges
+    auto white = bitmap(21, 21, 0xffffffff);
+    auto result = engine.apply({white}, filters(R"({"type": "Blur", "radius": 1})"));
+    ASSERT_EQ(0xffffffff, result->getPixel(10, 10));
+    auto corner = result->getPixel(0, 0);
+    ASSERT_EQ(0xffffff00, corner & 0xffffff00);
+    ASSERT_LT(corner & 0xff, 0xff);
+    ASSERT_GT(corner & 0xff, 0);
+
+    // A single pixel spreads out symmetrically
+    auto dot = bitmap(11, 11, 0x00000000);
+    dot->setPixel(5, 5, 0xffffffff);
+    auto spread = engine.apply({dot}, filters(R"({"type": "Blur", "radius": 1})"));
+    auto center = spread->getPixel(5, 5) & 0xff;
+    auto side = spread->getPixel(4, 5) & 0xff;
+    ASSERT_GT(center, side);
+    ASSERT_GT(side, 0);
+    ASSERT_EQ(side, spread->getPixel(6, 5) & 0xff);
+    ASSERT_EQ(side, spread->getPixel(5, 4) & 0xff);
+    ASSERT_EQ(side, spread->getPixel(5, 6) & 0xff);
+    ASSERT_EQ(0, spread->getPixel(0, 0) & 0xff);
+
+    // The radius is scaled to pixels
+    auto scaled = engine.apply({dot}, filters(R"({"type": "Blur", "radius": 1})"), 2.0f);
+    ASSERT_LT(scaled->getPixel(5, 5) & 0xff, center);
+}
+
+TEST_F(FilterEngineTest, Gradient)
+{
+    auto source = bitmap(8, 1, 0x000000ff);
+    auto result = engine.apply({source}, filters(R"({
+      "type": "Gradient",
+      "gradient": {"type": "linear", "colorRange": ["black", "white"], "inputRange": [0, 1], "angle": 90}
+    })"));
+
+    ASSERT_EQ(8, result->width);
+    for (int x = 1; x < 8; x++)
+        ASSERT_GT(result->getPixel(x, 0) >> 24, result->getPixel(x - 1, 0) >> 24);
+    ASSERT_LT(result->getPixel(0, 0) >> 24, 0x20);
+    ASSERT_GT(result->getPixel(7, 0) >> 24, 0xe0);
+}
+
+TEST_F(FilterEngineTest, Noise)
+{
+    auto gray = bitmap(8, 8, 0x808080ff);
+    auto chain = filters(R"({"type": "Noise", "sigma": 20})");
+
+    auto first = engine.apply({gray}, chain, 1.0f, 1);
+    auto second = FilterEngine().apply({gray}, chain, 1.0f, 1);
+    ASSERT_EQ(first->pixels, second->pixels);
+
+    auto other = FilterEngine().apply({gray}, chain, 1.0f, 2);
+    ASSERT_NE(first->pixels, other->pixels);
+
+    // Without useColor the noise is the same in every channel
+    auto p = first->getPixel(3, 3);
+    ASSERT_EQ((p >> 24) & 0xff, (p >> 16) & 0xff);
+    ASSERT_EQ(0xff, p & 0xff);
+
+    auto colored = engine.apply({gray}, filters(R"({"type": "Noise", "sigma": 20, "useColor": true})"), 1.0f, 1);
+    int differences = 0;
+    for (int i = 0; i < 8; i++) {
+        auto q = colored->getPixel(i, 0);
+        if (((q >> 24) & 0xff) != ((q >> 16) & 0xff))
+            differences++;
+    }
+    ASSERT_GT(differences, 0);
+}
+
+TEST_F(FilterEngineTest, Indices)
+{
+    auto red = bitmap(2, 2, 0xff0000ff);
+    auto blue = bitmap(2, 2, 0x0000ffff);
+
+    // Out-of-range sources are skipped, so the last image is the output
+    auto skipped = engine.apply({red, blue}, filters(R"({"type": "Grayscale", "amount": 1, "source": 5})"));
+    ASSERT_EQ(0x0000ffff, skipped->getPixel(0, 0));
+
+    // Sources may be selected explicitly
+    auto first = engine.apply({red, blue}, filters(R"({"type": "Grayscale", "amount": 0, "source": 0})"));
+    ASSERT_EQ(0xff0000ff, first->getPixel(0, 0));
+
+    auto negative = engine.apply({red, blue}, filters(R"({"type": "Grayscale", "amount": 0, "source": -2})"));
+    ASSERT_EQ(0xff0000ff, negative->getPixel(0, 0));
+
+    ASSERT_FALSE(engine.apply({}, filters(R"({"type": "Blur", "radius": 2})")));
+}
+
+TEST_F(FilterEngineTest, Cache)
+{
+    auto red = bitmap(2, 2, 0xff0000ff);
+    auto chain = filters(R"({"type": "Blur", "radius": 1})");
+
+    auto first = engine.apply({red}, chain);
+    ASSERT_EQ(1, engine.cached());
+    ASSERT_EQ(first, engine.apply({red}, chain));
+    ASSERT_EQ(first, engine.apply({red}, filters(R"({"type": "Blur", "radius": 1})")));
+    ASSERT_EQ(1, engine.cached());
+
+    // A different bitmap, even with the same pixels, is a different source
+    auto copy = std::make_shared<Bitmap>(*red);
+    auto second = engine.apply({copy}, chain);
+    ASSERT_NE(first, second);
+    ASSERT_EQ(first->pixels, second->pixels);
+    ASSERT_EQ(2, engine.cached());
+
+    engine.clearCache();
+    ASSERT_EQ(0, engine.cached());
+
+    FilterEngine small(1);
+    small.apply({red}, chain);
+    small.apply({copy}, chain);
+    ASSERT_EQ(1, small.cached());
+
+    FilterEngine none(0);
+    ASSERT_NE(none.apply({red}, chain), none.apply({red}, chain));
+}
+
+TEST_F(FilterEngineTest, DropShadow)
+{
+    auto element = bitmap(10, 10, 0x00000000);
+    for (int y = 2; y < 4; y++)
+        for (int x = 2; x < 4; x++)
+            element->setPixel(x, y, 0xffffffff);
+
+    JsonData json(R"({"type": "DropShadow", "color": "blue", "horizontalOffset": 3, "verticalOffset": 3})");
+    auto shadow = GraphicFilter::create(*context, json.get());
+    ASSERT_TRUE(shadow.isGraphicFilter());
+
+    auto result = engine.applyGraphicFilters(element, shadow);
+    ASSERT_EQ(10, result->width);
+    ASSERT_EQ(0xffffffff, result->getPixel(2, 2));
+    ASSERT_EQ(0xffffffff, result->getPixel(3, 3));
+    ASSERT_EQ(0x0000ffff, result->getPixel(5, 5));
+    ASSERT_EQ(0x0000ffff, result->getPixel(6, 6));
+    ASSERT_EQ(0, result->getPixel(0, 0) & 0xff);
+    ASSERT_EQ(0, result->getPixel(7, 7) & 0xff);
+
+    // A blurred shadow spreads beyond the offset element
+    JsonData blurred(R"({"type": "DropShadow", "color": "blue", "horizontalOffset": 3, "verticalOffset": 3, "radius": 1})");
+    auto soft = engine.applyGraphicFilters(element, GraphicFilter::create(*context, blurred.get()));
+    ASSERT_GT(soft->getPixel(7, 5) & 0xff, 0);
+    ASSERT_LT(soft->getPixel(6, 6) & 0xff, 0xff);
+}
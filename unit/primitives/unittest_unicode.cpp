@@ -16,6 +16,7 @@
 #include "gtest/gtest.h"
 
 #include "apl/primitives/unicode.h"
+#include "apl/utils/corelocalemethods.h"
 
 #include "../testeventloop.h"
 
@@ -98,3 +99,64 @@ TEST_F(UnicodeTest, StringSlice) {
     for (const auto& m : STRING_SLICE_TESTS)
         ASSERT_EQ(m.expected, utf8StringSlice(m.original, m.start, m.end));
 }
+
+struct CaseTest {
+    std::string original;
+    std::string locale;
+    std::string upper;
+    std::string lower;
+};
+
+static auto CASE_TESTS = std::vector<CaseTest> {
+    { u8"", "", u8"", u8"" },
+    { u8"Hello, World!", "", u8"HELLO, WORLD!", u8"hello, world!" },
+    { u8"Fuß", "de-DE", u8"FUSS", u8"fuß" },                  // Sharp s expands to two characters
+    { u8"Straße", "", u8"STRASSE", u8"straße" },
+    { u8"ǅemal", "", u8"ǄEMAL", u8"ǆemal" },                 // Title case digraph
+    { u8"Ωμέγα", "el-GR", u8"ΩΜΈΓΑ", u8"ωμέγα" },
+    { u8"ΟΔΥΣΣΕΥΣ", "", u8"ΟΔΥΣΣΕΥΣ", u8"οδυσσευς" },        // Final sigma at the end of a word
+    { u8"ΣΑΣ ΣΑΣ.", "", u8"ΣΑΣ ΣΑΣ.", u8"σας σας." },
+    { u8"Σ", "", u8"Σ", u8"σ" },                              // A lone sigma is not final
+    { u8"ΌΣ'Σ", "", u8"ΌΣ'Σ", u8"όσ'ς" },                     // Apostrophes are case-ignorable
+    { u8"ᾳ", "", u8"ΑΙ", u8"ᾳ" },                             // Iota subscript
+    { u8"Привет", "ru-RU", u8"ПРИВЕТ", u8"привет" },
+    { u8"Ծիրան", "", u8"ԾԻՐԱՆ", u8"ծիրան" },
+    { u8"ｆｕｌｌ", "", u8"ＦＵＬＬ", u8"ｆｕｌｌ" },              // Full width
+    { u8"\U00010428\U00010400", "", u8"\U00010400\U00010400", u8"\U00010428\U00010428" },  // Deseret
+    { u8"日本語", "ja-JP", u8"日本語", u8"日本語" },
+    { u8"\u0130stanbul", "", u8"\u0130STANBUL", u8"i\u0307stanbul" },  // Dotted capital I keeps its dot
+    { u8"\u0130stanbul", "tr-TR", u8"\u0130STANBUL", u8"istanbul" },
+    { u8"Diyarbak\u0131r", "tr", u8"D\u0130YARBAKIR", u8"diyarbak\u0131r" },
+    { u8"I\u011eDIR", "az-AZ", u8"I\u011eDIR", u8"\u0131\u011fd\u0131r" },
+    { u8"I\u0307", "tr-TR", u8"I\u0307", u8"i" },                      // Dot above after I
+    { u8"fizik", "TR_tr", u8"F\u0130Z\u0130K", u8"fizik" },
+    { u8"i\u0307\u0301", "lt-LT", u8"I\u0301", u8"i\u0307\u0301" },  // Lithuanian removes the explicit dot
+    { u8"I\u0301", "lt", u8"I\u0301", u8"i\u0307\u0301" },            // ...and adds it back under an accent
+    { u8"\u00cd", "lt", u8"\u00cd", u8"i\u0307\u0301" },
+    { u8"\u00cc", "lt", u8"\u00cc", u8"i\u0307\u0300" },
+    { u8"J", "lt", u8"J", u8"j" },
+    { u8"i\u0307", "", u8"I\u0307", u8"i\u0307" },
+    { "A\xff" "b\xc3", "", "A\xff" "B\xc3", "a\xff" "b\xc3" },     // Malformed bytes are copied
+    { "\xe0\x80\x80z", "", "\xe0\x80\x80Z", "\xe0\x80\x80z" },      // Overlong encoding
+};
+
+TEST_F(UnicodeTest, CaseMapping) {
+    for (const auto& m : CASE_TESTS) {
+        ASSERT_EQ(m.upper, utf8ToUpper(m.original, m.locale)) << m.original << " " << m.locale;
+        ASSERT_EQ(m.lower, utf8ToLower(m.original, m.locale)) << m.original << " " << m.locale;
+    }
+}
+
+TEST_F(UnicodeTest, CoreLocaleMethods) {
+    CoreLocaleMethods methods;
+
+    ASSERT_EQ("FUZZY", methods.toUpperCase("fuzzy", ""));
+    ASSERT_EQ(u8"ÀÉÎÕÜ", methods.toUpperCase(u8"àéîõü", ""));
+    ASSERT_EQ(u8"àéîõü", methods.toLowerCase(u8"ÀÉÎÕÜ", "fr-FR"));
+
+    // Cached results are keyed by locale
+    ASSERT_EQ(u8"İĞ", methods.toUpperCase(u8"iğ", "tr-TR"));
+    ASSERT_EQ(u8"IĞ", methods.toUpperCase(u8"iğ", "en-US"));
+    ASSERT_EQ(u8"İĞ", methods.toUpperCase(u8"iğ", "tr-TR"));
+    ASSERT_EQ(u8"ıi", methods.toLowerCase(u8"Iİ", "tr-TR"));
+}
@@ -15,6 +15,7 @@
 
 #include "../testeventloop.h"
 
+#include "apl/component/pagercomponent.h"
 #include "apl/focus/focusmanager.h"
 #include "apl/touch/pointerevent.h"
 #include "apl/animation/coreeasing.h"
@@ -993,6 +994,120 @@ TEST_F(NativeGesturesPagerTest, PageFlingLeftDefault)
     ASSERT_EQ("yellow2", component->getDisplayedChildAt(0)->getId());
 }
 
+TEST_F(NativeGesturesPagerTest, PageFlingLeftHostComposited)
+{
+    config->enableExperimentalFeature(RootConfig::kExperimentalFeatureHostPageTransitions);
+    loadDocument(PAGER_TEST_DEFAULT_ANIMATION, PAGER_DEFAULT_DATA);
+    ASSERT_TRUE(ConsoleMessage());  // Extra "do" data
+
+    advanceTime(10);
+    root->clearDirty();
+
+    auto currentChild = component->getChildAt(1);
+    auto nextChild = component->getChildAt(2);
+    ASSERT_TRUE(component->getCalculated(kPropertyPageTransition).isNull());
+
+    root->handlePointerEvent(PointerEvent(PointerEventType::kPointerDown, Point(400,10)));
+    advanceTime(100);
+    root->handlePointerEvent(PointerEvent(PointerEventType::kPointerMove, Point(200,10)));
+    root->clearPending();
+
+    // The drag phase is published when the move starts
+    auto drag = component->getCalculated(kPropertyPageTransition);
+    ASSERT_TRUE(drag.isMap());
+    ASSERT_EQ("drag", drag.get("phase").asString());
+    ASSERT_NEAR(0.4, drag.get("startAmount").asNumber(), 0.001);
+    ASSERT_EQ(0, drag.get("duration").asNumber());
+    ASSERT_TRUE(CheckDirty(component, kPropertyPageTransition, kPropertyNotifyChildrenChanged));
+
+    // Following the pointer does not touch the pager
+    root->handlePointerEvent(PointerEvent(PointerEventType::kPointerMove, Point(100,10)));
+    root->clearPending();
+    ASSERT_TRUE(CheckDirty(component));
+    ASSERT_EQ(drag, component->getCalculated(kPropertyPageTransition));
+
+    root->handlePointerEvent(PointerEvent(PointerEventType::kPointerUp, Point(100,10)));
+    root->clearPending();
+
+    // The pages are left alone, the settle phase is described once on the pager
+    ASSERT_FALSE(CheckDirty(currentChild, kPropertyTransform));
+    ASSERT_FALSE(CheckDirty(nextChild, kPropertyTransform));
+    ASSERT_TRUE(CheckTransform(Transform2D::translateX(0), currentChild));
+    ASSERT_TRUE(CheckTransform(Transform2D::translateX(0), nextChild));
+    ASSERT_TRUE(CheckDirty(component, kPropertyPageTransition));
+
+    auto transition = component->getCalculated(kPropertyPageTransition);
+    ASSERT_TRUE(transition.isMap());
+    ASSERT_EQ("settle", transition.get("phase").asString());
+    ASSERT_NEAR(0.6, transition.get("startAmount").asNumber(), 0.001);
+    ASSERT_EQ(1, transition.get("endAmount").asNumber());
+    ASSERT_EQ(config->getDefaultPagerAnimationDuration(), transition.get("duration").asNumber());
+    ASSERT_FALSE(transition.has("amount"));
+    ASSERT_EQ("left", transition.get("direction").asString());
+    ASSERT_TRUE(transition.get("forward").asBoolean());
+    ASSERT_EQ(Object(CoreEasing::linear()), transition.get("easing"));
+
+    auto current = transition.get("currentChild");
+    ASSERT_EQ(currentChild->getUniqueId(), current.get("uid").asString());
+    ASSERT_EQ(0, current.get("from").at(0).get("translateX").asNumber());
+    ASSERT_EQ(-500, current.get("to").at(0).get("translateX").asNumber());
+
+    auto next = transition.get("nextChild");
+    ASSERT_EQ(nextChild->getUniqueId(), next.get("uid").asString());
+    ASSERT_EQ(500, next.get("from").at(0).get("translateX").asNumber());
+    ASSERT_EQ(0, next.get("to").at(0).get("translateX").asNumber());
+
+    // Nothing changes while the viewhost animates, the published descriptor is left alone
+    root->clearDirty();
+    advanceTime(300);
+    ASSERT_TRUE(CheckDirty(component));
+    ASSERT_TRUE(CheckDirty(currentChild));
+    ASSERT_TRUE(CheckDirty(nextChild));
+    ASSERT_EQ(transition, component->getCalculated(kPropertyPageTransition));
+    ASSERT_NEAR(0.6, transition.get("startAmount").asNumber(), 0.001);
+
+    // Finished, the final state is committed and the descriptor withdrawn
+    advanceTime(300);
+    ASSERT_TRUE(CheckDirty(component, kPropertyCurrentPage, kPropertyPageTransition, kPropertyNotifyChildrenChanged));
+    ASSERT_TRUE(component->getCalculated(kPropertyPageTransition).isNull());
+    ASSERT_TRUE(CheckTransform(Transform2D::translateX(0), currentChild));
+    ASSERT_TRUE(CheckTransform(Transform2D::translateX(0), nextChild));
+    ASSERT_EQ(2, component->pagePosition());
+    ASSERT_EQ(1, component->getDisplayedChildCount());
+    ASSERT_EQ("yellow2", component->getDisplayedChildAt(0)->getId());
+}
+
+TEST_F(NativeGesturesPagerTest, SetPageHostComposited)
+{
+    config->enableExperimentalFeature(RootConfig::kExperimentalFeatureHostPageTransitions);
+    loadDocument(PAGER_TEST_DEFAULT_ANIMATION, PAGER_DEFAULT_DATA);
+    ASSERT_TRUE(ConsoleMessage());  // Extra "do" data
+
+    advanceTime(10);
+    root->clearDirty();
+
+    PagerComponent::setPageUtil(context, component, 2, kPageDirectionForward, ActionRef(nullptr), false);
+    root->clearPending();
+
+    auto transition = component->getCalculated(kPropertyPageTransition);
+    ASSERT_TRUE(transition.isMap());
+    ASSERT_EQ("animate", transition.get("phase").asString());
+    ASSERT_EQ(0, transition.get("startAmount").asNumber());
+    ASSERT_EQ(1, transition.get("endAmount").asNumber());
+    ASSERT_EQ(config->getDefaultPagerAnimationDuration(), transition.get("duration").asNumber());
+
+    // The pager is not touched until the transition is over
+    root->clearDirty();
+    advanceTime(300);
+    ASSERT_TRUE(CheckDirty(component));
+    ASSERT_EQ(1, component->pagePosition());
+
+    advanceTime(300);
+    ASSERT_TRUE(CheckDirty(component, kPropertyCurrentPage, kPropertyPageTransition, kPropertyNotifyChildrenChanged));
+    ASSERT_TRUE(component->getCalculated(kPropertyPageTransition).isNull());
+    ASSERT_EQ(2, component->pagePosition());
+}
+
 TEST_F(NativeGesturesPagerTest, PageFlingChangeOfNav)
 {
     loadDocument(PAGER_TEST_DEFAULT_ANIMATION, PAGER_DEFAULT_DATA);
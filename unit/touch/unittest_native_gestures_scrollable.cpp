@@ -15,8 +15,10 @@
 
 #include "../testeventloop.h"
 
+#include "apl/component/scrollablecomponent.h"
 #include "apl/touch/pointerevent.h"
 #include "apl/animation/coreeasing.h"
+#include "apl/touch/utils/unidirectionaleasingscroller.h"
 
 using namespace apl;
 
@@ -719,6 +721,100 @@ TEST_F(NativeGesturesScrollableTest, LiveFlingBackwardsSpaced)
     ASSERT_EQ(Point(0, 475), component->scrollPosition());
 }
 
+static const char *LONG_SCROLL_TEST = R"({
+  "type": "APL",
+  "version": "1.4",
+  "mainTemplate": {
+    "items": {
+      "type": "Sequence",
+      "width": 200,
+      "height": 300,
+      "data": "${Array.range(500)}",
+      "items": {
+        "type": "Frame",
+        "id": "item${index}",
+        "width": 200,
+        "height": 100
+      }
+    }
+  }
+})";
+
+static int
+countLaidOutChildren(const ComponentPtr& component)
+{
+    auto count = 0;
+    for (auto i = 0; i < component->getChildCount(); i++) {
+        if (!component->getChildAt(i)->getCalculated(kPropertyBounds).getRect().empty())
+            count++;
+    }
+    return count;
+}
+
+TEST_F(NativeGesturesScrollableTest, FlingProjection)
+{
+    loadDocument(LONG_SCROLL_TEST);
+    advanceTime(10);
+
+    auto finished = false;
+    auto scrollable = std::static_pointer_cast<ScrollableComponent>(component);
+    // A velocity of 8 dp/ms towards the end travels 20000 dp with the configured deceleration
+    auto scroller = UnidirectionalEasingScroller::make(scrollable, [&finished]() { finished = true; }, Point(0, -8));
+    scroller->updateOffset(0);
+    ASSERT_NEAR(20000, scroller->getDestination().getY(), 0.1);
+
+    scroller->updateOffset(200);
+    ASSERT_FALSE(finished);
+    auto position = component->scrollPosition();
+    ASSERT_LT(0, position.getY());
+    ASSERT_LT(0, scroller->getVelocity().getY());
+
+    // Children swept over are laid out enough to be displayed
+    auto index = static_cast<int>(position.getY() / 100);
+    ASSERT_EQ("item" + std::to_string(index), component->getDisplayedChildAt(0)->getId());
+
+    // Nothing is laid out past the viewport until the fling gets there or settles
+    ASSERT_TRUE(component->getChildAt(index + 5)->getCalculated(kPropertyBounds).getRect().empty());
+    ASSERT_TRUE(component->getChildAt(204)->getCalculated(kPropertyBounds).getRect().empty());
+
+    scroller->updateOffset(scroller->getDuration());
+    ASSERT_TRUE(finished);
+    ASSERT_NEAR(20000, component->scrollPosition().getY(), 0.1);
+    ASSERT_EQ("item200", component->getDisplayedChildAt(0)->getId());
+
+    // The child cache around the resting position is backfilled
+    ASSERT_FALSE(component->getChildAt(204)->getCalculated(kPropertyBounds).getRect().empty());
+    ASSERT_TRUE(component->getChildAt(300)->getCalculated(kPropertyBounds).getRect().empty());
+}
+
+TEST_F(NativeGesturesScrollableTest, FlingInterruptedLaysOutLess)
+{
+    loadDocument(LONG_SCROLL_TEST);
+    advanceTime(10);
+
+    // A scroll command over the same distance finds out how far it can go up front
+    auto scrollable = std::static_pointer_cast<ScrollableComponent>(component);
+    auto command = UnidirectionalEasingScroller::make(scrollable, []() {}, Point(0, 20000), 1000);
+    command->updateOffset(0);
+    auto commandLaidOut = countLaidOutChildren(component);
+    ASSERT_LT(200, commandLaidOut);
+
+    loadDocument(LONG_SCROLL_TEST);
+    advanceTime(10);
+
+    // A fling that is stopped early only laid out what it passed over
+    scrollable = std::static_pointer_cast<ScrollableComponent>(component);
+    auto fling = UnidirectionalEasingScroller::make(scrollable, []() {}, Point(0, -8));
+    for (apl_duration_t offset = 0; offset <= 200; offset += 16)
+        fling->updateOffset(offset);
+    fling = nullptr;
+
+    auto index = static_cast<int>(component->scrollPosition().getY() / 100);
+    auto flingLaidOut = countLaidOutChildren(component);
+    ASSERT_LT(flingLaidOut, commandLaidOut);
+    ASSERT_GE(index + 10, flingLaidOut);
+}
+
 static const char *SCROLL_SNAP_START_TEST = R"({
   "type": "APL",
   "version": "1.4",